@@ -1,6 +1,9 @@
 QT += gui
 
-HEADERS += qsourcehighliter.h \
-           languagedata.h
+include($$PWD/QSourceLexer.pri)
 
-SOURCES += qsourcehighliter.cpp
+HEADERS += $$PWD/qsourcehighliter.h \
+           $$PWD/qsourcehtmlexporter.h
+
+SOURCES += $$PWD/qsourcehighliter.cpp \
+           $$PWD/qsourcehtmlexporter.cpp
@@ -0,0 +1,19 @@
+INCLUDEPATH += $$PWD
+
+# the keyword tables are built at compile time
+CONFIG += c++14
+
+HEADERS += $$PWD/qsourcelexer.h \
+           $$PWD/qsourcedetector.h \
+           $$PWD/qsourcefilelexer.h \
+           $$PWD/qsourceparallellexer.h \
+           $$PWD/keywordtable.h \
+           $$PWD/languagedata.h \
+           $$PWD/simdscan.h
+
+SOURCES += $$PWD/qsourcelexer.cpp \
+           $$PWD/qsourcedetector.cpp \
+           $$PWD/qsourcefilelexer.cpp \
+           $$PWD/qsourceparallellexer.cpp \
+           $$PWD/keywordtable.cpp \
+           $$PWD/simdscan.cpp
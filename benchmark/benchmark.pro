@@ -0,0 +1,16 @@
+QT       += core gui
+
+include(../QSourceHighlite.pri)
+
+CONFIG += c++14 console
+CONFIG -= app_bundle
+DEFINES += QT_DEPRECATED_WARNINGS
+
+TARGET = benchmark
+
+SOURCES += \
+    main.cpp
+
+HEADERS += \
+    corpus.h \
+    samples.h
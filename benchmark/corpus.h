@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2019 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 3 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ */
+
+/*
+ * Large generated documents, one per language, mixing comments, strings,
+ * numbers, keywords and long lines. They are made from a fixed seed, so
+ * every run, of the benchmark and of the tests, sees the same documents.
+ * Also reads the memory the process takes, which both of them report.
+ */
+#ifndef CORPUS_H
+#define CORPUS_H
+
+#include "qsourcelexer.h"
+
+#include <QFile>
+#include <QStringList>
+#include <QTextStream>
+
+enum CommentStyle {
+    //  // and /* */
+    SlashComments,
+    //  #
+    HashComments,
+    //  <!-- -->
+    XmlComments,
+    //  prose with fenced code blocks
+    MarkdownText
+};
+
+struct Corpus {
+    const char *name;
+    QSourceLexer::Language language;
+    CommentStyle comments;
+    //what opens a construct that runs on to the end of the document, e.g a
+    //comment, or nullptr if the language has none
+    const char *opener;
+    //some words of the language, space separated
+    const char *words;
+};
+
+static const Corpus corpora[] = {
+    {"cpp", QSourceLexer::CodeCpp, SlashComments, "/*",
+     "int bool char const static struct class namespace return if for while nullptr true std string vector auto"},
+    {"c", QSourceLexer::CodeC, SlashComments, "/*",
+     "int char const static struct return if for while NULL unsigned long size_t sizeof void"},
+    {"js", QSourceLexer::CodeJs, SlashComments, "/*",
+     "var let const function return if for while true false null undefined this new console"},
+    {"bash", QSourceLexer::CodeBash, HashComments, "cat <<EOF\n",
+     "if then fi for do done echo export local return while case esac cd grep"},
+    {"php", QSourceLexer::CodePHP, SlashComments, "/*",
+     "function return if foreach while echo array class public private new true false null"},
+    {"qml", QSourceLexer::CodeQML, SlashComments, "/*",
+     "import Item Rectangle property int string bool var id width height anchors true false"},
+    {"python", QSourceLexer::CodePython, HashComments, "\"\"\"\n",
+     "def return if elif else for while in import from class True False None self print len"},
+    {"rust", QSourceLexer::CodeRust, SlashComments, "/*",
+     "fn let mut pub struct impl match if else for while return Some None String Vec println!"},
+    {"java", QSourceLexer::CodeJava, SlashComments, "/*",
+     "public private static final class int boolean String return if for while new null true"},
+    {"csharp", QSourceLexer::CodeCSharp, SlashComments, "/*",
+     "public private static class int bool string var return if foreach while new null true"},
+    {"go", QSourceLexer::CodeGo, SlashComments, "/*",
+     "func package import var const type struct return if for range go defer nil true string"},
+    {"v", QSourceLexer::CodeV, SlashComments, "/*",
+     "fn mut pub struct module import return if else for match none true false string int"},
+    {"sql", QSourceLexer::CodeSQL, SlashComments, "/*",
+     "SELECT FROM WHERE INSERT INTO VALUES UPDATE SET DELETE CREATE TABLE INT VARCHAR NULL AND"},
+    {"json", QSourceLexer::CodeJSON, SlashComments, "/*",
+     "true false null"},
+    {"xml", QSourceLexer::CodeXML, XmlComments, "<!--",
+     "item value name list entry"},
+    {"css", QSourceLexer::CodeCSS, SlashComments, "/*",
+     "color background margin padding display block none border width height"},
+    {"typescript", QSourceLexer::CodeTypeScript, SlashComments, "/*",
+     "let const function interface type number string boolean return if for class export"},
+    {"yaml", QSourceLexer::CodeYAML, HashComments, nullptr,
+     "name version true false null image ports environment"},
+    {"ini", QSourceLexer::CodeINI, HashComments, nullptr,
+     "name path enabled true false size"},
+    {"markdown", QSourceLexer::CodeMarkdown, MarkdownText, "```cpp\n",
+     "the a code block document language table state line fast with of"}
+};
+
+/* a small fixed generator so that every run sees the same documents */
+class Random
+{
+public:
+    quint32 next() {
+        _state = _state * 1664525u + 1013904223u;
+        return _state >> 8;
+    }
+    int below(int n) { return int(next() % quint32(n)); }
+
+private:
+    quint32 _state = 12345;
+};
+
+static QString makeLine(const Corpus &corpus, const QStringList &words, Random &random,
+                        int &commentLines) {
+    const QString word = words.at(random.below(words.size()));
+    const QString other = words.at(random.below(words.size()));
+
+    if (corpus.comments == MarkdownText) {
+        //inside a fenced code block
+        if (commentLines > 0) {
+            --commentLines;
+            if (commentLines == 0) return QStringLiteral("```");
+            return QStringLiteral("    %1(x%2, \"%3\"); // %1")
+                .arg(word).arg(random.below(100)).arg(other);
+        }
+        static const char *const fences[] = {"cpp", "python", "sql", "js", "bash"};
+        switch (random.below(8)) {
+        case 0: return QStringLiteral("# %1 %2").arg(word, other);
+        case 1: return QStringLiteral("- %1 and `%2`").arg(word, other);
+        case 2:
+            commentLines = 4 + random.below(8);
+            return QStringLiteral("```") + QLatin1String(fences[random.below(5)]);
+        case 3: return QString();
+        default: {
+            QString line;
+            const int count = 8 + random.below(12);
+            for (int i = 0; i < count; ++i)
+                line += words.at(random.below(words.size())) + QLatin1Char(' ');
+            return line;
+        }
+        }
+    }
+
+    if (corpus.comments == XmlComments) {
+        switch (random.below(6)) {
+        case 0: return QStringLiteral("<!-- %1 %2 comment -->").arg(word, other);
+        case 1: return QStringLiteral("<%1 id=\"%2\" size=\"%3\">").arg(word, other).arg(random.below(1000));
+        case 2: return QStringLiteral("    <%1>%2 &amp; text</%1>").arg(word, other);
+        case 3: return QStringLiteral("</%1>").arg(word);
+        case 4: return QString();
+        default: {
+            QString line = QStringLiteral("<%1>").arg(word);
+            for (int i = 0; i < 40; ++i)
+                line += QStringLiteral("<%1 key=\"v%2\"/>").arg(other).arg(i);
+            return line;
+        }
+        }
+    }
+
+    const QString lineComment = corpus.comments == HashComments ? QStringLiteral("#")
+                                                                : QStringLiteral("//");
+
+    //inside a block comment
+    if (commentLines > 0) {
+        --commentLines;
+        if (corpus.comments == HashComments)
+            return QStringLiteral("# %1 continues the comment %2").arg(word, other);
+        return commentLines == 0 ? QStringLiteral(" * %1 ends here */").arg(word)
+                                 : QStringLiteral(" * %1 inside the comment %2").arg(word, other);
+    }
+
+    switch (random.below(10)) {
+    case 0:
+        return QStringLiteral("%1 a line comment with %2 and %3").arg(lineComment, word, other);
+    case 1:
+        commentLines = 3;
+        if (corpus.comments == HashComments)
+            return QStringLiteral("# %1 starts a comment").arg(word);
+        return QStringLiteral("/* %1 starts a comment").arg(word);
+    case 2:
+        return QStringLiteral("    %1 name = \"text with \\\"escapes\\\" and %2\\n\";").arg(word, other);
+    case 3:
+        return QStringLiteral("    %1 value = 0x1F + %2 * 3.14 - %3;")
+            .arg(word).arg(random.below(100000)).arg(random.below(10));
+    case 4:
+    case 5:
+    case 6: {
+        QString line = QStringLiteral("    ");
+        const int count = 4 + random.below(8);
+        for (int i = 0; i < count; ++i) {
+            line += words.at(random.below(words.size()));
+            line += i % 3 == 2 ? QStringLiteral("(x%1, ").arg(i) : QStringLiteral(" ");
+        }
+        return line + QStringLiteral("0);");
+    }
+    case 7: {
+        //a long line with a bit of everything
+        QString line;
+        for (int i = 0; i < 30; ++i) {
+            line += words.at(random.below(words.size()));
+            line += QStringLiteral(" v%1 = %2 + \"s%1\"; ").arg(i).arg(random.below(1000));
+        }
+        return line;
+    }
+    case 8:
+        return random.below(2) ? QStringLiteral("%1 block {").arg(word) : QStringLiteral("}");
+    default:
+        return QString();
+    }
+}
+
+static QString makeCorpus(const Corpus &corpus, int lines) {
+    const QStringList words = QString::fromLatin1(corpus.words).split(QLatin1Char(' '));
+    Random random;
+    int commentLines = 0;
+
+    QString code;
+    QTextStream stream(&code);
+    for (int i = 0; i < lines; ++i)
+        stream << makeLine(corpus, words, random, commentLines) << '\n';
+    return code;
+}
+
+/**
+ * @brief Reads a field of /proc/self/status, e.g VmRSS
+ * @return the value in KiB or -1 where that isn't available
+ */
+static inline qint64 memoryKiB(const char *field) {
+    QFile status(QStringLiteral("/proc/self/status"));
+    if (!status.open(QIODevice::ReadOnly | QIODevice::Text)) return -1;
+    const QByteArray prefix = QByteArray(field) + ':';
+    for (const QByteArray &line : status.readAll().split('\n')) {
+        if (line.startsWith(prefix))
+            return line.mid(prefix.size()).trimmed().split(' ').first().toLongLong();
+    }
+    return -1;
+}
+
+#endif // CORPUS_H
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2019 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 3 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ */
+
+/*
+ * Measures the highlighter on large generated documents, one per language.
+ * For every language it prints the startup time, from starting a new process
+ * to its first lexed line, which would include building the word tables if
+ * they weren't constant, the average time lex() and lexState() take per line
+ * without a document, the time to highlight the whole document and the
+ * setFormat() calls that takes per line, the time to open it in Deferred mode
+ * and in Parallel mode, the latency of single keystrokes and of opening and
+ * closing a comment (or a python string, heredoc or code fence) above most of
+ * the document, and the memory the document and its highlighting take. After
+ * that it measures how fast the language of a sample is detected, and whether
+ * it is detected right.
+ *
+ * The documents are generated from a fixed seed so runs can be compared.
+ *
+ * Usage: benchmark [lines] [languages...] [-platform offscreen]
+ * e.g benchmark 100000 cpp sql -platform offscreen
+ */
+#include "corpus.h"
+#include "qsourcedetector.h"
+#include "qsourcehighliter.h"
+#include "samples.h"
+
+#include <QElapsedTimer>
+#include <QGuiApplication>
+#include <QProcess>
+#include <QTextBlock>
+#include <QTextCursor>
+#include <QTextDocument>
+#include <QTextStream>
+
+#include <algorithm>
+#include <cstdio>
+
+//processes started to measure the startup of a language, the median counts
+static const int startupRuns = 5;
+
+static QString formatMiB(qint64 kib) {
+    return kib < 0 ? QStringLiteral("n/a") : QString::number(kib / 1024.0, 'f', 1) + QStringLiteral(" MiB");
+}
+
+/**
+ * @brief The child process of startupMsecs(), started as
+ * benchmark --first-line <language>. It runs before anything of Qt is set
+ * up, lexes a single line and says so on stdout.
+ */
+static int lexFirstLine(const char *name) {
+    for (const Corpus &corpus : corpora) {
+        if (qstrcmp(corpus.name, name) != 0) continue;
+        QVector<QSourceLexer::Token> tokens;
+        QSourceLexer::lex(QStringLiteral("x = y;"), corpus.language, tokens);
+        std::fputs("lexed\n", stdout);
+        std::fflush(stdout);
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Starts this program again to lex a single line of a language
+ * @return milliseconds from starting the process to the line being lexed,
+ * the median of a few runs, or -1 if the process didn't answer
+ */
+static double startupMsecs(const Corpus &corpus) {
+    QVector<qint64> runs;
+    for (int i = 0; i < startupRuns; ++i) {
+        QProcess process;
+        QElapsedTimer timer;
+        timer.start();
+        process.start(QCoreApplication::applicationFilePath(),
+                      {QStringLiteral("--first-line"), QLatin1String(corpus.name)});
+        if (!process.waitForReadyRead()) return -1;
+        runs.append(timer.nsecsElapsed());
+        process.waitForFinished();
+    }
+    std::sort(runs.begin(), runs.end());
+    return runs.at(runs.size() / 2) / 1e6;
+}
+
+static void run(const Corpus &corpus, int lines, QTextStream &out) {
+    const QString code = makeCorpus(corpus, lines);
+    const double startup = startupMsecs(corpus);
+
+    QElapsedTimer timer;
+    QVector<QSourceLexer::Token> tokens;
+
+    //the lexer alone, every line with its tokens and then only its state
+    const QStringList codeLines = code.split(QLatin1Char('\n'));
+    int state = corpus.language;
+    timer.start();
+    for (const QString &line : codeLines)
+        state = QSourceLexer::lex(line, state, tokens);
+    const qint64 lexNsecs = timer.nsecsElapsed();
+    state = corpus.language;
+    timer.start();
+    for (const QString &line : codeLines)
+        state = QSourceLexer::lexState(line, state);
+    const qint64 stateNsecs = timer.nsecsElapsed();
+
+    const qint64 memoryBefore = memoryKiB("VmRSS");
+
+    QTextDocument doc;
+    QSourceHighliter highlighter(&doc);
+    highlighter.setCurrentLanguage(QSourceHighliter::Language(corpus.language));
+
+    timer.start();
+    doc.setPlainText(code);
+    const qint64 fullMs = timer.elapsed();
+
+    const qint64 memoryAfter = memoryKiB("VmRSS");
+
+    //only the top of the document is painted, the rest only gets its state
+    qint64 deferredMs = 0;
+    {
+        QTextDocument deferredDoc;
+        QSourceHighliter deferred(&deferredDoc);
+        deferred.setCurrentLanguage(QSourceHighliter::Language(corpus.language));
+        deferred.setHighlightMode(QSourceHighliter::Deferred);
+        timer.start();
+        deferredDoc.setPlainText(code);
+        deferredMs = timer.elapsed();
+    }
+
+    //the whole document is lexed on all cores before it is painted
+    qint64 parallelMs = 0;
+    {
+        QTextDocument parallelDoc;
+        QSourceHighliter parallel(&parallelDoc);
+        parallel.setCurrentLanguage(QSourceHighliter::Language(corpus.language));
+        parallel.setHighlightMode(QSourceHighliter::Parallel);
+        timer.start();
+        parallelDoc.setPlainText(code);
+        parallelMs = timer.elapsed();
+    }
+
+    //single keystrokes all over the document, each one is highlighted
+    //before insertText() returns
+    Random random;
+    QVector<qint64> keystrokes;
+    for (int i = 0; i < 200; ++i) {
+        QTextCursor cursor(doc.findBlockByNumber(random.below(doc.blockCount())));
+        cursor.movePosition(QTextCursor::EndOfBlock);
+        timer.start();
+        cursor.insertText(QStringLiteral("x"));
+        keystrokes.append(timer.nsecsElapsed());
+    }
+    std::sort(keystrokes.begin(), keystrokes.end());
+
+    //the worst case: a comment that swallows the rest of the document, only
+    //for languages that have one
+    qint64 commentMs = -1;
+    if (corpus.opener) {
+        QTextCursor cursor(doc.findBlockByNumber(doc.blockCount() / 10));
+        const QString open = QString::fromLatin1(corpus.opener);
+        timer.start();
+        cursor.insertText(open);
+        cursor.movePosition(QTextCursor::Left, QTextCursor::KeepAnchor, open.size());
+        cursor.removeSelectedText();
+        commentMs = timer.elapsed();
+    }
+
+    //the setFormat() calls a highlighted line takes, counted on a second
+    //pass so the statistics don't slow down the timed one. Markdown blocks
+    //are counted under the language of their fence
+    QSourceHighliter::Statistics formats;
+    highlighter.setStatisticsCallback([&formats](QSourceHighliter::Language, const QSourceHighliter::Statistics &block) {
+        formats += block;
+    });
+    highlighter.setStatisticsEnabled(true);
+    highlighter.rehighlight();
+
+    out << qSetFieldWidth(12) << corpus.name
+        << qSetFieldWidth(14) << (startup < 0 ? QStringLiteral("n/a") : QString::number(startup, 'f', 2))
+        << qSetFieldWidth(12) << QString::number(double(lexNsecs) / codeLines.size(), 'f', 1)
+        << qSetFieldWidth(12) << QString::number(double(stateNsecs) / codeLines.size(), 'f', 1)
+        << qSetFieldWidth(10) << fullMs
+        << qSetFieldWidth(14) << QString::number(double(formats.formatCalls) / qMax<quint64>(formats.blocks, 1), 'f', 1)
+        << qSetFieldWidth(14) << deferredMs
+        << qSetFieldWidth(14) << parallelMs
+        << qSetFieldWidth(14) << QString::number(keystrokes.at(keystrokes.size() / 2) / 1000.0, 'f', 1)
+        << qSetFieldWidth(14) << QString::number(keystrokes.last() / 1000.0, 'f', 1)
+        << qSetFieldWidth(12) << (commentMs < 0 ? QStringLiteral("n/a") : QString::number(commentMs))
+        << qSetFieldWidth(14)
+        << formatMiB(memoryBefore < 0 || memoryAfter < 0 ? -1 : memoryAfter - memoryBefore)
+        << qSetFieldWidth(0) << '\n';
+    out.flush();
+}
+
+static const char *sampleName(QSourceLexer::Language language) {
+    for (const Sample &sample : samples) {
+        if (sample.language == language) return sample.name;
+    }
+    return "?";
+}
+
+/**
+ * @brief Detects the language of one sample, repeated up to the size the
+ * detector looks at
+ * @return whether it was detected right
+ */
+static bool detect(const Sample &sample, QTextStream &out) {
+    const QString snippet = QString::fromUtf8(sample.text);
+    QString text;
+    while (text.size() < QSourceDetector::sampleSize)
+        text += snippet;
+    text.truncate(QSourceDetector::sampleSize);
+
+    const QSourceLexer::Language detected = QSourceDetector::detect(text);
+
+    //a single call is too short to time
+    QElapsedTimer timer;
+    int runs = 0;
+    timer.start();
+    do {
+        QSourceDetector::detect(text);
+        ++runs;
+    } while (timer.nsecsElapsed() < 100 * 1000 * 1000);
+    const double micros = timer.nsecsElapsed() / 1000.0 / runs;
+
+    out << qSetFieldWidth(12) << sample.name
+        << qSetFieldWidth(12) << sampleName(detected)
+        << qSetFieldWidth(10) << QString::number(micros, 'f', 1)
+        << qSetFieldWidth(10) << QString::number(text.size() / micros, 'f', 1)
+        << qSetFieldWidth(0) << '\n';
+    out.flush();
+    return detected == sample.language;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc == 3 && qstrcmp(argv[1], "--first-line") == 0)
+        return lexFirstLine(argv[2]);
+
+    QGuiApplication app(argc, argv);
+
+    const QStringList args = app.arguments();
+    int lines = args.size() > 1 ? args.at(1).toInt() : 100000;
+    if (lines <= 0) lines = 100000;
+    const QStringList selected = args.mid(2);
+
+    QTextStream out(stdout);
+    out << lines << " lines per language\n";
+    out << qSetFieldWidth(12) << "language"
+        << qSetFieldWidth(14) << "startup ms"
+        << qSetFieldWidth(12) << "lex ns"
+        << qSetFieldWidth(12) << "state ns"
+        << qSetFieldWidth(10) << "full ms"
+        << qSetFieldWidth(14) << "formats/line"
+        << qSetFieldWidth(14) << "deferred ms"
+        << qSetFieldWidth(14) << "parallel ms"
+        << qSetFieldWidth(14) << "key median us"
+        << qSetFieldWidth(14) << "key max us"
+        << qSetFieldWidth(12) << "comment ms"
+        << qSetFieldWidth(14) << "memory"
+        << qSetFieldWidth(0) << '\n';
+
+    for (const Corpus &corpus : corpora) {
+        if (!selected.isEmpty() && !selected.contains(QLatin1String(corpus.name)))
+            continue;
+        run(corpus, lines, out);
+    }
+
+    out << "peak memory: " << formatMiB(memoryKiB("VmHWM")) << '\n';
+
+    out << '\n' << QSourceDetector::sampleSize << " characters per detection\n";
+    out << qSetFieldWidth(12) << "language"
+        << qSetFieldWidth(12) << "detected"
+        << qSetFieldWidth(10) << "us"
+        << qSetFieldWidth(10) << "Mchar/s"
+        << qSetFieldWidth(0) << '\n';
+    int right = 0;
+    int total = 0;
+    for (const Sample &sample : samples) {
+        if (!selected.isEmpty() && !selected.contains(QLatin1String(sample.name)))
+            continue;
+        right += detect(sample, out);
+        ++total;
+    }
+    out << right << " of " << total << " detected right\n";
+    return 0;
+}
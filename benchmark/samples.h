@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) 2019 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 3 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ */
+
+/*
+ * Short but typical pieces of code, one per language, for measuring the
+ * language detection. They are repeated up to the size of a sample.
+ */
+#ifndef SAMPLES_H
+#define SAMPLES_H
+
+#include "qsourcelexer.h"
+
+struct Sample {
+    const char *name;
+    QSourceLexer::Language language;
+    const char *text;
+};
+
+static const Sample samples[] = {
+    {"cpp", QSourceLexer::CodeCpp,
+     "#include <QString>\n"
+     "#include <vector>\n"
+     "\n"
+     "namespace util {\n"
+     "\n"
+     "template <typename T>\n"
+     "class Cache\n"
+     "{\n"
+     "public:\n"
+     "    explicit Cache(std::size_t size) : _size(size) {}\n"
+     "    bool contains(const T &key) const { return _items.count(key) > 0; }\n"
+     "private:\n"
+     "    std::size_t _size;\n"
+     "    std::vector<T> _items;\n"
+     "};\n"
+     "\n"
+     "} // namespace util\n"},
+    {"c", QSourceLexer::CodeC,
+     "#include <stdio.h>\n"
+     "#include <stdlib.h>\n"
+     "\n"
+     "typedef struct node {\n"
+     "    int value;\n"
+     "    struct node *next;\n"
+     "} node_t;\n"
+     "\n"
+     "static node_t *push(node_t *head, int value) {\n"
+     "    node_t *n = malloc(sizeof(node_t));\n"
+     "    if (n == NULL) return head;\n"
+     "    n->value = value;\n"
+     "    n->next = head;\n"
+     "    return n;\n"
+     "}\n"
+     "\n"
+     "int main(void) {\n"
+     "    printf(\"%d\\n\", push(NULL, 1)->value);\n"
+     "    return 0;\n"
+     "}\n"},
+    {"js", QSourceLexer::CodeJs,
+     "const express = require('express');\n"
+     "const app = express();\n"
+     "\n"
+     "function handler(req, res) {\n"
+     "    const items = req.body.items || [];\n"
+     "    const total = items.reduce((sum, item) => sum + item.price, 0);\n"
+     "    if (total === 0) {\n"
+     "        console.log('empty order');\n"
+     "    }\n"
+     "    res.json({ total: total, count: items.length });\n"
+     "}\n"
+     "\n"
+     "app.post('/order', handler);\n"
+     "app.listen(3000, () => console.log('listening'));\n"},
+    {"bash", QSourceLexer::CodeBash,
+     "#!/bin/bash\n"
+     "set -euo pipefail\n"
+     "\n"
+     "for file in \"$@\"; do\n"
+     "    if [ -f \"$file\" ]; then\n"
+     "        echo \"processing $file\"\n"
+     "        count=$(wc -l < \"$file\")\n"
+     "        export LINES=$count\n"
+     "    else\n"
+     "        echo \"missing: $file\" >&2\n"
+     "    fi\n"
+     "done\n"},
+    {"php", QSourceLexer::CodePHP,
+     "<?php\n"
+     "namespace App\\Controller;\n"
+     "\n"
+     "class UserController\n"
+     "{\n"
+     "    private $repository;\n"
+     "\n"
+     "    public function show($id)\n"
+     "    {\n"
+     "        $user = $this->repository->find($id);\n"
+     "        if ($user === null) {\n"
+     "            throw new NotFoundException();\n"
+     "        }\n"
+     "        echo json_encode(['name' => $user->name]);\n"
+     "    }\n"
+     "}\n"},
+    {"qml", QSourceLexer::CodeQML,
+     "import QtQuick 2.12\n"
+     "import QtQuick.Controls 2.12\n"
+     "\n"
+     "Rectangle {\n"
+     "    id: root\n"
+     "    width: 400\n"
+     "    height: 300\n"
+     "    color: \"white\"\n"
+     "    property int count: 0\n"
+     "\n"
+     "    Text {\n"
+     "        anchors.centerIn: parent\n"
+     "        text: \"clicked \" + root.count + \" times\"\n"
+     "    }\n"
+     "    MouseArea {\n"
+     "        anchors.fill: parent\n"
+     "        onClicked: root.count++\n"
+     "    }\n"
+     "}\n"},
+    {"python", QSourceLexer::CodePython,
+     "import os\n"
+     "from collections import defaultdict\n"
+     "\n"
+     "\n"
+     "class Index:\n"
+     "    def __init__(self, root):\n"
+     "        self.root = root\n"
+     "        self.files = defaultdict(list)\n"
+     "\n"
+     "    def scan(self):\n"
+     "        for path, dirs, names in os.walk(self.root):\n"
+     "            for name in names:\n"
+     "                if name.endswith('.py'):\n"
+     "                    self.files[name].append(path)\n"
+     "                elif name.startswith('.'):\n"
+     "                    continue\n"
+     "        return len(self.files)\n"},
+    {"rust", QSourceLexer::CodeRust,
+     "use std::collections::HashMap;\n"
+     "\n"
+     "#[derive(Debug)]\n"
+     "struct Counter {\n"
+     "    words: HashMap<String, usize>,\n"
+     "}\n"
+     "\n"
+     "impl Counter {\n"
+     "    fn add(&mut self, text: &str) {\n"
+     "        for word in text.split_whitespace() {\n"
+     "            *self.words.entry(word.to_string()).or_insert(0) += 1;\n"
+     "        }\n"
+     "    }\n"
+     "}\n"
+     "\n"
+     "fn main() {\n"
+     "    let mut counter = Counter { words: HashMap::new() };\n"
+     "    counter.add(\"a b a\");\n"
+     "    println!(\"{:?}\", counter);\n"
+     "}\n"},
+    {"java", QSourceLexer::CodeJava,
+     "package com.example.shop;\n"
+     "\n"
+     "import java.util.ArrayList;\n"
+     "import java.util.List;\n"
+     "\n"
+     "public class Order {\n"
+     "    private final List<Item> items = new ArrayList<>();\n"
+     "\n"
+     "    public void add(Item item) {\n"
+     "        items.add(item);\n"
+     "    }\n"
+     "\n"
+     "    @Override\n"
+     "    public String toString() {\n"
+     "        return \"Order with \" + items.size() + \" items\";\n"
+     "    }\n"
+     "\n"
+     "    public static void main(String[] args) {\n"
+     "        System.out.println(new Order());\n"
+     "    }\n"
+     "}\n"},
+    {"csharp", QSourceLexer::CodeCSharp,
+     "using System;\n"
+     "using System.Collections.Generic;\n"
+     "\n"
+     "namespace Shop\n"
+     "{\n"
+     "    public class Order\n"
+     "    {\n"
+     "        public List<string> Items { get; set; } = new List<string>();\n"
+     "\n"
+     "        public void Print()\n"
+     "        {\n"
+     "            foreach (var item in Items)\n"
+     "            {\n"
+     "                Console.WriteLine(item);\n"
+     "            }\n"
+     "        }\n"
+     "    }\n"
+     "}\n"},
+    {"go", QSourceLexer::CodeGo,
+     "package main\n"
+     "\n"
+     "import (\n"
+     "\t\"fmt\"\n"
+     "\t\"strings\"\n"
+     ")\n"
+     "\n"
+     "type Counter struct {\n"
+     "\twords map[string]int\n"
+     "}\n"
+     "\n"
+     "func (c *Counter) Add(text string) {\n"
+     "\tfor _, word := range strings.Fields(text) {\n"
+     "\t\tc.words[word]++\n"
+     "\t}\n"
+     "}\n"
+     "\n"
+     "func main() {\n"
+     "\tc := &Counter{words: make(map[string]int)}\n"
+     "\tc.Add(\"a b a\")\n"
+     "\tfmt.Println(len(c.words))\n"
+     "}\n"},
+    {"v", QSourceLexer::CodeV,
+     "module main\n"
+     "\n"
+     "import os\n"
+     "\n"
+     "struct Counter {\n"
+     "mut:\n"
+     "\twords map[string]int\n"
+     "}\n"
+     "\n"
+     "fn (mut c Counter) add(text string) {\n"
+     "\tfor word in text.split(' ') {\n"
+     "\t\tc.words[word]++\n"
+     "\t}\n"
+     "}\n"
+     "\n"
+     "fn main() {\n"
+     "\tmut c := Counter{}\n"
+     "\tc.add('a b a')\n"
+     "\tprintln(c.words.len)\n"
+     "}\n"},
+    {"sql", QSourceLexer::CodeSQL,
+     "CREATE TABLE users (\n"
+     "    id INT PRIMARY KEY AUTO_INCREMENT,\n"
+     "    name VARCHAR(100) NOT NULL,\n"
+     "    created DATETIME DEFAULT CURRENT_TIMESTAMP\n"
+     ");\n"
+     "\n"
+     "INSERT INTO users (name) VALUES ('alice'), ('bob');\n"
+     "\n"
+     "SELECT u.name, COUNT(o.id) AS orders\n"
+     "FROM users u\n"
+     "LEFT JOIN orders o ON o.user_id = u.id\n"
+     "WHERE u.created > '2019-01-01'\n"
+     "GROUP BY u.name\n"
+     "ORDER BY orders DESC;\n"},
+    {"json", QSourceLexer::CodeJSON,
+     "{\n"
+     "    \"name\": \"qsourcehighlite\",\n"
+     "    \"version\": \"1.0.0\",\n"
+     "    \"private\": true,\n"
+     "    \"keywords\": [\"syntax\", \"highlighter\", \"qt\"],\n"
+     "    \"dependencies\": {\n"
+     "        \"left-pad\": \"^1.3.0\"\n"
+     "    },\n"
+     "    \"count\": 42,\n"
+     "    \"nothing\": null\n"
+     "}\n"},
+    {"xml", QSourceLexer::CodeXML,
+     "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+     "<project name=\"shop\">\n"
+     "    <!-- the modules of the project -->\n"
+     "    <modules>\n"
+     "        <module path=\"core\" enabled=\"true\"/>\n"
+     "        <module path=\"ui\">user interface</module>\n"
+     "    </modules>\n"
+     "</project>\n"},
+    {"css", QSourceLexer::CodeCSS,
+     "body {\n"
+     "    margin: 0;\n"
+     "    padding: 0;\n"
+     "    font-family: sans-serif;\n"
+     "    background-color: #fafafa;\n"
+     "}\n"
+     "\n"
+     ".header > a:hover {\n"
+     "    color: rgb(20, 20, 20);\n"
+     "    text-decoration: underline;\n"
+     "    border-bottom: 1px solid #ccc !important;\n"
+     "}\n"
+     "\n"
+     "@media (max-width: 600px) {\n"
+     "    .sidebar { display: none; }\n"
+     "}\n"},
+    {"typescript", QSourceLexer::CodeTypeScript,
+     "import { Injectable } from '@angular/core';\n"
+     "\n"
+     "export interface Item {\n"
+     "    id: number;\n"
+     "    name: string;\n"
+     "    done: boolean;\n"
+     "}\n"
+     "\n"
+     "@Injectable()\n"
+     "export class TodoService {\n"
+     "    private items: Item[] = [];\n"
+     "\n"
+     "    add(name: string): Item {\n"
+     "        const item: Item = { id: this.items.length, name, done: false };\n"
+     "        this.items.push(item);\n"
+     "        return item;\n"
+     "    }\n"
+     "}\n"},
+    {"yaml", QSourceLexer::CodeYAML,
+     "version: \"3.8\"\n"
+     "services:\n"
+     "  web:\n"
+     "    image: nginx:latest\n"
+     "    ports:\n"
+     "      - \"80:80\"\n"
+     "    environment:\n"
+     "      - DEBUG=false\n"
+     "    depends_on:\n"
+     "      - db\n"
+     "  db:\n"
+     "    image: postgres:12\n"
+     "    restart: always\n"},
+    {"ini", QSourceLexer::CodeINI,
+     "[General]\n"
+     "name=QSourceHighlite\n"
+     "version=1.0\n"
+     "; the window\n"
+     "[Window]\n"
+     "width=800\n"
+     "height=600\n"
+     "maximized=false\n"},
+    {"markdown", QSourceLexer::CodeMarkdown,
+     "# QSourceHighlite\n"
+     "\n"
+     "A syntax highlighter for **Qt** applications.\n"
+     "\n"
+     "## Usage\n"
+     "\n"
+     "Add the files to your project and create a highlighter:\n"
+     "\n"
+     "```cpp\n"
+     "auto highlighter = new QSourceHighliter(doc);\n"
+     "```\n"
+     "\n"
+     "- fast\n"
+     "- many languages, see [the list](#languages)\n"}
+};
+
+#endif // SAMPLES_H
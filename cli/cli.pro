@@ -0,0 +1,13 @@
+QT       += core
+QT       -= gui
+
+include(../QSourceLexer.pri)
+
+CONFIG += c++14 console
+CONFIG -= app_bundle
+DEFINES += QT_DEPRECATED_WARNINGS
+
+TARGET = qsourcehighlite
+
+SOURCES += \
+    main.cpp
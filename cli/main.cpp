@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2019 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 3 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ */
+
+/*
+ * Highlights files without a display, using every core.
+ *
+ * Usage: qsourcehighlite [-o dir] [-l language] [-j threads] files or directories
+ */
+#include "qsourcedetector.h"
+#include "qsourcefilelexer.h"
+#include "qsourcelexer.h"
+
+#include <QAtomicInteger>
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDir>
+#include <QDirIterator>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QSet>
+#include <QTextStream>
+#include <QThreadPool>
+
+static const char *const kindNames[] = {
+    "Block",
+    "KeyWord",
+    "String",
+    "Comment",
+    "Type",
+    "Other",
+    "NumLiteral",
+    "BuiltIn",
+    "Link",
+    "Color"
+};
+
+/**
+ * @brief Maps file extensions, which also serve as the names for -l, to
+ * languages
+ */
+static const QHash<QString, QSourceLexer::Language> &languages() {
+    static const QHash<QString, QSourceLexer::Language> map = {
+        {QStringLiteral("c"), QSourceLexer::CodeC},
+        {QStringLiteral("h"), QSourceLexer::CodeCpp},
+        {QStringLiteral("cpp"), QSourceLexer::CodeCpp},
+        {QStringLiteral("cc"), QSourceLexer::CodeCpp},
+        {QStringLiteral("cxx"), QSourceLexer::CodeCpp},
+        {QStringLiteral("hpp"), QSourceLexer::CodeCpp},
+        {QStringLiteral("hh"), QSourceLexer::CodeCpp},
+        {QStringLiteral("hxx"), QSourceLexer::CodeCpp},
+        {QStringLiteral("js"), QSourceLexer::CodeJs},
+        {QStringLiteral("mjs"), QSourceLexer::CodeJs},
+        {QStringLiteral("sh"), QSourceLexer::CodeBash},
+        {QStringLiteral("bash"), QSourceLexer::CodeBash},
+        {QStringLiteral("php"), QSourceLexer::CodePHP},
+        {QStringLiteral("qml"), QSourceLexer::CodeQML},
+        {QStringLiteral("py"), QSourceLexer::CodePython},
+        {QStringLiteral("rs"), QSourceLexer::CodeRust},
+        {QStringLiteral("java"), QSourceLexer::CodeJava},
+        {QStringLiteral("cs"), QSourceLexer::CodeCSharp},
+        {QStringLiteral("go"), QSourceLexer::CodeGo},
+        {QStringLiteral("v"), QSourceLexer::CodeV},
+        {QStringLiteral("sql"), QSourceLexer::CodeSQL},
+        {QStringLiteral("json"), QSourceLexer::CodeJSON},
+        {QStringLiteral("xml"), QSourceLexer::CodeXML},
+        {QStringLiteral("html"), QSourceLexer::CodeXML},
+        {QStringLiteral("htm"), QSourceLexer::CodeXML},
+        {QStringLiteral("svg"), QSourceLexer::CodeXML},
+        {QStringLiteral("ui"), QSourceLexer::CodeXML},
+        {QStringLiteral("css"), QSourceLexer::CodeCSS},
+        {QStringLiteral("ts"), QSourceLexer::CodeTypeScript},
+        {QStringLiteral("yaml"), QSourceLexer::CodeYAML},
+        {QStringLiteral("yml"), QSourceLexer::CodeYAML},
+        {QStringLiteral("ini"), QSourceLexer::CodeINI},
+        {QStringLiteral("conf"), QSourceLexer::CodeINI},
+        {QStringLiteral("cfg"), QSourceLexer::CodeINI},
+        {QStringLiteral("md"), QSourceLexer::CodeMarkdown},
+        {QStringLiteral("markdown"), QSourceLexer::CodeMarkdown}
+    };
+    return map;
+}
+
+struct Job {
+    QString path;
+    //where the tokens go, relative to the output directory
+    QString outputName;
+    //-1 to detect it from the start of the file
+    int language;
+    //found in a directory, it is skipped unless its start gives the
+    //language away, e.g a shebang
+    bool optional;
+};
+
+/* what became of a file */
+enum Outcome {
+    Highlighted,
+    Unrecognized,
+    Failed
+};
+
+/* a fallback the detector never returns, nothing was recognized */
+static const QSourceLexer::Language unrecognized = static_cast<QSourceLexer::Language>(0);
+
+/**
+ * @brief The language of a file
+ * @return true if it is known, i.e forced, picked by the suffix or to be
+ * detected because the file has no suffix
+ */
+static bool fileLanguage(const QString &path, int forcedLanguage, int &language) {
+    language = forcedLanguage;
+    const QString suffix = QFileInfo(path).suffix().toLower();
+    if (language >= 0 || suffix.isEmpty()) return true;
+    if (!languages().contains(suffix)) return false;
+    language = languages().value(suffix);
+    return true;
+}
+
+/**
+ * @brief Makes the output name of a file unique, e.g two main.cpp from
+ * different directories become main.cpp and main.cpp-2
+ */
+static QString uniqueName(const QString &name, QSet<QString> &used) {
+    QString unique = name;
+    for (int n = 2; used.contains(unique); ++n)
+        unique = name + QLatin1Char('-') + QString::number(n);
+    used.insert(unique);
+    return unique;
+}
+
+/**
+ * @brief Writes the tokens of one line, one token per row:
+ * line offset length kind
+ */
+static void writeTokens(QTextStream &out, qint64 line, const QVector<QSourceLexer::Token> &tokens) {
+    for (const QSourceLexer::Token &token : tokens) {
+        out << line << ' ' << token.offset << ' ' << token.length << ' '
+            << kindNames[token.kind] << '\n';
+    }
+}
+
+/**
+ * @brief Lexes a whole file, it is mapped and never loaded as a whole
+ * @return Failed if the file couldn't be read or written
+ */
+static Outcome highlightFile(const Job &job, const QString &outputDir) {
+    int language = job.language;
+    if (language < 0) {
+        QFile file(job.path);
+        if (!file.open(QIODevice::ReadOnly)) return Failed;
+        const QString sample = QString::fromUtf8(file.read(QSourceDetector::sampleSize));
+        //the words of a LICENSE or a Makefile always score for some language
+        language = job.optional ? QSourceDetector::detectSignature(sample, unrecognized)
+                                : QSourceDetector::detect(sample);
+        if (language == unrecognized) return Unrecognized;
+    }
+
+    QFile output;
+    QTextStream out;
+    if (!outputDir.isEmpty()) {
+        const QString outputPath = outputDir + QLatin1Char('/') + job.outputName +
+                                   QLatin1String(".tokens");
+        QDir().mkpath(QFileInfo(outputPath).absolutePath());
+        output.setFileName(outputPath);
+        if (!output.open(QIODevice::WriteOnly | QIODevice::Truncate)) return Failed;
+        out.setDevice(&output);
+    }
+
+    const auto sink = [&out](qint64 line, QStringView, const QVector<QSourceLexer::Token> &tokens) {
+        if (out.device()) writeTokens(out, line, tokens);
+    };
+    return QSourceFileLexer::lexFile(job.path, language, sink) ? Highlighted : Failed;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName(QStringLiteral("qsourcehighlite"));
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("Highlights source files in parallel"));
+    parser.addHelpOption();
+    parser.addPositionalArgument(QStringLiteral("paths"),
+                                 QStringLiteral("Files or directories to highlight."),
+                                 QStringLiteral("paths..."));
+    const QCommandLineOption outputOption({QStringLiteral("o"), QStringLiteral("output")},
+        QStringLiteral("Write the tokens of every file into <dir>, nothing is written otherwise."),
+        QStringLiteral("dir"));
+    const QCommandLineOption languageOption({QStringLiteral("l"), QStringLiteral("language")},
+        QStringLiteral("Use <language> (a file extension, e.g cpp) instead of detecting it."),
+        QStringLiteral("language"));
+    const QCommandLineOption threadsOption({QStringLiteral("j"), QStringLiteral("threads")},
+        QStringLiteral("Use <n> threads, defaults to the number of cores."),
+        QStringLiteral("n"));
+    parser.addOption(outputOption);
+    parser.addOption(languageOption);
+    parser.addOption(threadsOption);
+    parser.process(app);
+
+    QTextStream err(stderr);
+
+    int forcedLanguage = -1;
+    if (parser.isSet(languageOption)) {
+        const QString name = parser.value(languageOption).toLower();
+        if (!languages().contains(name)) {
+            err << "unknown language: " << name << '\n';
+            return 1;
+        }
+        forcedLanguage = languages().value(name);
+    }
+
+    //collect the files first, the directory walk stays out of the timing
+    QVector<Job> jobs;
+    QSet<QString> outputNames;
+    bool skipped = false;
+    for (const QString &path : parser.positionalArguments()) {
+        const QFileInfo info(path);
+        int language;
+        if (info.isDir()) {
+            //files we don't know are skipped, those without a suffix are
+            //only taken if their start names the language, e.g scripts
+            const QDir dir(path);
+            QDirIterator it(path, QDir::Files, QDirIterator::Subdirectories);
+            while (it.hasNext()) {
+                const QString file = it.next();
+                if (fileLanguage(file, forcedLanguage, language))
+                    jobs.append(Job{file, uniqueName(dir.relativeFilePath(file), outputNames), language, true});
+            }
+        } else if (info.isFile()) {
+            if (fileLanguage(path, forcedLanguage, language)) {
+                jobs.append(Job{path, uniqueName(info.fileName(), outputNames), language, false});
+            } else {
+                err << "unknown language, use -l: " << path << '\n';
+                skipped = true;
+            }
+        } else {
+            err << "no such file or directory: " << path << '\n';
+            skipped = true;
+        }
+    }
+    if (jobs.isEmpty() && !skipped) parser.showHelp(1);
+
+    QThreadPool pool;
+    if (parser.isSet(threadsOption))
+        pool.setMaxThreadCount(qMax(1, parser.value(threadsOption).toInt()));
+
+    const QString outputDir = parser.value(outputOption);
+    QAtomicInteger<qint64> bytes;
+    QAtomicInt files;
+    QAtomicInt failed;
+
+    QElapsedTimer timer;
+    timer.start();
+
+    for (const Job &job : qAsConst(jobs)) {
+        pool.start([job, &outputDir, &bytes, &files, &failed]() {
+            switch (highlightFile(job, outputDir)) {
+            case Highlighted:
+                bytes.fetchAndAddRelaxed(QFileInfo(job.path).size());
+                files.fetchAndAddRelaxed(1);
+                break;
+            case Unrecognized:
+                break;
+            case Failed:
+                failed.fetchAndAddRelaxed(1);
+                break;
+            }
+        });
+    }
+    pool.waitForDone();
+
+    const double seconds = qMax<qint64>(timer.nsecsElapsed(), 1) / 1e9;
+    const double megabytes = bytes.loadRelaxed() / (1024.0 * 1024.0);
+
+    QTextStream out(stdout);
+    out << files.loadRelaxed() << " files, " << QString::number(megabytes, 'f', 2) << " MB in "
+        << QString::number(seconds * 1000, 'f', 1) << " ms ("
+        << pool.maxThreadCount() << " threads): "
+        << QString::number(files.loadRelaxed() / seconds, 'f', 1) << " files/s, "
+        << QString::number(megabytes / seconds, 'f', 2) << " MB/s\n";
+
+    if (failed.loadRelaxed() > 0) {
+        err << failed.loadRelaxed() << " files couldn't be read or written\n";
+        return 1;
+    }
+    return skipped ? 1 : 0;
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2019 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 3 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ */
+#include "keywordtable.h"
+
+/* orders a word of the table against the word that is looked up, both
+ * start with the same character */
+static inline int compareWord(const KeywordTable::Word &entry, const QChar *word, int length) {
+    if (entry.length != length)
+        return entry.length < length ? -1 : 1;
+    for (int i = 1; i < length; ++i) {
+        const ushort a = static_cast<unsigned char>(entry.text[i]);
+        const ushort b = word[i].unicode();
+        if (a != b) return a < b ? -1 : 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Finds the category of a word
+ * @param word the first character of the word
+ * @param length length of the word
+ * @return the category or None if the word isn't part of the language
+ */
+KeywordTable::Category KeywordTable::lookup(const QChar *word, int length) const
+{
+    if (length <= 0 || word[0].unicode() >= firstChars) return None;
+
+    const int key = runKey(word[0].unicode(), length);
+    int low = _runs[key];
+    int high = _runs[key + 1];
+    while (low < high) {
+        const int mid = (low + high) / 2;
+        const int order = compareWord(_words[mid], word, length);
+        if (order == 0) return _words[mid].category;
+        if (order < 0) low = mid + 1;
+        else high = mid;
+    }
+    return None;
+}
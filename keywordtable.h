@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2019 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 3 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ */
+#ifndef KEYWORDTABLE_H
+#define KEYWORDTABLE_H
+
+#include <QChar>
+
+/**
+ * @brief All the words of one language, built at compile time
+ * @details The words live in one sorted constexpr array per language in
+ * languagedata.h, sorted by first character, length and text. The table
+ * only adds an index from the first character and the length of a word to
+ * the run of words with both, so a lookup reads two neighbouring entries of
+ * the index and then compares only the few words of that run. Words of
+ * lengthRuns - 1 characters or more share the last run of their first
+ * character. Nothing is built at runtime and nothing is allocated, the data
+ * sits in read only memory.
+ */
+class KeywordTable
+{
+public:
+    enum Category : quint8 {
+        None = 0,
+        Type,
+        Keyword,
+        Literal,
+        BuiltIn,
+        Other
+    };
+
+    //a word and its category, the length is taken from the literal
+    struct Word {
+        template <int N>
+        constexpr Word(const char (&word)[N], Category wordCategory)
+            : text(word),
+              length(N - 1),
+              category(wordCategory)
+        {
+        }
+
+        const char *text;
+        int length;
+        Category category;
+    };
+
+    static constexpr int firstChars = 128;
+    //runs per first character, longer words share the last one
+    static constexpr int lengthRuns = 16;
+
+    constexpr KeywordTable() = default;
+
+    template <int N>
+    constexpr KeywordTable(const Word (&words)[N])
+        : _words(words)
+    {
+        for (int key = 0, i = 0; key <= firstChars * lengthRuns; ++key) {
+            while (i < N && runKey(static_cast<unsigned char>(words[i].text[0]), words[i].length) < key)
+                ++i;
+            _runs[key] = static_cast<quint16>(i);
+        }
+    }
+
+    /**
+     * @brief Whether the words are sorted by first character, length and
+     * text, without duplicates, which lookup() relies on
+     */
+    template <int N>
+    static constexpr bool isSorted(const Word (&words)[N]) {
+        for (int i = 1; i < N; ++i) {
+            if (compare(words[i - 1], words[i]) >= 0) return false;
+        }
+        return true;
+    }
+
+    Category lookup(const QChar *word, int length) const;
+
+private:
+    static constexpr int runKey(int first, int length) {
+        return first * lengthRuns + (length < lengthRuns ? length : lengthRuns - 1);
+    }
+
+    static constexpr int compare(const Word &a, const Word &b) {
+        if (a.text[0] != b.text[0])
+            return static_cast<unsigned char>(a.text[0]) < static_cast<unsigned char>(b.text[0]) ? -1 : 1;
+        if (a.length != b.length)
+            return a.length < b.length ? -1 : 1;
+        for (int i = 1; i < a.length; ++i) {
+            if (a.text[i] != b.text[i])
+                return static_cast<unsigned char>(a.text[i]) < static_cast<unsigned char>(b.text[i]) ? -1 : 1;
+        }
+        return 0;
+    }
+
+    const Word *_words = nullptr;
+    //the words of run key are _words[_runs[key]] up to _words[_runs[key + 1]]
+    quint16 _runs[firstChars * lengthRuns + 1] = {};
+};
+
+#endif // KEYWORDTABLE_H
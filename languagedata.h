@@ -11,2423 +11,1907 @@
  * for more details.
  *
  */
-#include <QMultiHash>
+#include "keywordtable.h"
 
 /* ------------------------
  * TEMPLATE FOR LANG DATA
  * -------------------------
  *
- * loadXXXData, where XXX is the language
- * keywords are the language keywords e.g, const
- * types are built-in types i.e, int, char, var
- * literals are words like, true false
- * builtin are the library functions
- * other can contain any other thing, for e.g, in cpp it contains the preprocessor
-
-    static const QMultiHash<char, QLatin1String> xxx_keywords = {
-    };
-
-    static const QMultiHash<char, QLatin1String> xxx_types = {
+ * xxx_words, where xxx is the language, holds every word of the language
+ * together with its category:
+ * Keyword are the language keywords e.g, const
+ * Type are built-in types i.e, int, char, var
+ * Literal are words like, true false
+ * BuiltIn are the library functions
+ * Other can contain any other thing, for e.g, in cpp it contains the preprocessor
+
+    static constexpr KeywordTable::Word xxx_words[] = {
+        {"word", KeywordTable::Keyword}
     };
+    static_assert(KeywordTable::isSorted(xxx_words), "xxx_words isn't sorted");
+    static constexpr KeywordTable xxxWords(xxx_words);
 
-    static const QMultiHash<char, QLatin1String> xxx_literals = {
-    };
-
-    static const QMultiHash<char, QLatin1String> xxx_builtin = {
-    };
+    The words are sorted by their first character, then by length and then
+    alphabetically, and every word is listed once with the category it is
+    highlighted as. The static_assert fails to compile otherwise.
 
-    static const QMultiHash<char, QLatin1String> xxx_other = {
-    };
+    Everything here is a compile time constant, nothing is built or
+    allocated at runtime.
 
 */
 
+/* used by the languages that have no word tables (e.g, INI) */
+static constexpr KeywordTable noWords{};
+
 /**********************************************************/
 /* C/C++ Data *********************************************/
 /**********************************************************/
 
-static const QMultiHash<char, QLatin1String> cpp_keywords = {
-    {('a'), QLatin1String("asm")},
-    {('a'), QLatin1String("auto")},
-    {('b'), QLatin1String("break")},
-    {('c'), QLatin1String("case")},
-    {('c'), QLatin1String("catch")},
-    {('c'), QLatin1String("const")},
-    {('c'), QLatin1String("const_cast")},
-    {('c'), QLatin1String("continue")},
-    {('d'), QLatin1String("default")},
-    {('d'), QLatin1String("delete")},
-    {('d'), QLatin1String("do")},
-    {('d'), QLatin1String("dynamic_cast")},
-    {('e'), QLatin1String("else")},
-    {('e'), QLatin1String("explicit")},
-    {('f'), QLatin1String("for")},
-    {('g'), QLatin1String("goto")},
-    {('i'), QLatin1String("if")},
-    {('m'), QLatin1String("mutable")},
-    {('n'), QLatin1String("namespace")},
-    {('n'), QLatin1String("new")},
-    {('o'), QLatin1String("operator")},
-    {('p'), QLatin1String("private")},
-    {('p'), QLatin1String("protected")},
-    {('p'), QLatin1String("public")},
-    {('r'), QLatin1String("register")},
-    {('r'), QLatin1String("reinterpret_cast")},
-    {('r'), QLatin1String("return")},
-    {('s'), QLatin1String("signal")},
-    {('s'), QLatin1String("signed")},
-    {('s'), QLatin1String("sizeof")},
-    {('s'), QLatin1String("slot")},
-    {('s'), QLatin1String("static")},
-    {('s'), QLatin1String("static_cast")},
-    {('s'), QLatin1String("switch")},
-    {('t'), QLatin1String("template")},
-    {('t'), QLatin1String("this")},
-    {('t'), QLatin1String("throw")},
-    {('t'), QLatin1String("try")},
-    {('t'), QLatin1String("typedef")},
-    {('u'), QLatin1String("unsigned")},
-    {('u'), QLatin1String("using")},
-    {('v'), QLatin1String("volatile")},
-    {('w'), QLatin1String("while")}
-};
-
-static const QMultiHash<char, QLatin1String> cpp_types = {
-    {('b'), QLatin1String("bool")},
-    {('c'), QLatin1String("char")},
-    {('c'), QLatin1String("class")},
-    {('d'), QLatin1String("double")},
-    {('e'), QLatin1String("enum")},
-    {('f'), QLatin1String("float")},
-    {('i'), QLatin1String("int")},
-    {('l'), QLatin1String("long")},
-    {('Q'), QLatin1String("QHash")},
-    {('Q'), QLatin1String("QList")},
-    {('Q'), QLatin1String("QMap")},
-    {('Q'), QLatin1String("QString")},
-    {('Q'), QLatin1String("QVector")},
-    {('s'), QLatin1String("short")},
-    {('s'), QLatin1String("size_t")},
-    {('s'), QLatin1String("ssize_t")},
-    {('s'), QLatin1String("struct")},
-    {('u'), QLatin1String("union")},
-    {('u'), QLatin1String("uint8_t")},
-    {('u'), QLatin1String("uint16_t")},
-    {('u'), QLatin1String("uint32_t")},
-    {('u'), QLatin1String("uint64_t")},
-    {('v'), QLatin1String("void")},
-    {('w'), QLatin1String("wchar_t")}
-};
-
-static const QMultiHash<char, QLatin1String> cpp_literals = {
-    {('f'), QLatin1String("false")},
-    {('n'), QLatin1String("nullptr")},
-    {('N'), QLatin1String("NULL")},
-    {('t'), QLatin1String("true")}
-};
-
-static const QMultiHash<char, QLatin1String> cpp_builtin = {
-    {('s'), QLatin1String("std")},
-    {('s'), QLatin1String("string")},
-    {('w'), QLatin1String("wstring")},
-    {('c'), QLatin1String("cin")},
-    {('c'), QLatin1String("cout")},
-    {('c'), QLatin1String("cerr")},
-    {('c'), QLatin1String("clog")},
-    {('s'), QLatin1String("stdin")},
-    {('s'), QLatin1String("stdout")},
-    {('s'), QLatin1String("stderr")},
-    {('s'), QLatin1String("stringstream")},
-    {('i'), QLatin1String("istringstream")},
-    {('o'), QLatin1String("ostringstream")},
-    {('a'), QLatin1String("auto_ptr")},
-    {('d'), QLatin1String("deque")},
-    {('l'), QLatin1String("list")},
-    {('q'), QLatin1String("queue")},
-    {('s'), QLatin1String("stack")},
-    {('v'), QLatin1String("vector")},
-    {('m'), QLatin1String("map")},
-    {('s'), QLatin1String("set")},
-    {('b'), QLatin1String("bitset")},
-    {('m'), QLatin1String("multiset")},
-    {('m'), QLatin1String("multimap")},
-    {('u'), QLatin1String("unordered_set")},
-    {('u'), QLatin1String("unordered_map")},
-    {('u'), QLatin1String("unordered_multiset")},
-    {('u'), QLatin1String("unordered_multimap")},
-    {('a'), QLatin1String("array")},
-    {('s'), QLatin1String("shared_ptr")},
-    {('a'), QLatin1String("abort")},
-    {('t'), QLatin1String("terminate")},
-    {('a'), QLatin1String("abs")},
-    {('a'), QLatin1String("acos")},
-    {('a'), QLatin1String("asin")},
-    {('a'), QLatin1String("atan2")},
-    {('a'), QLatin1String("atan")},
-    {('c'), QLatin1String("calloc")},
-    {('c'), QLatin1String("ceil")},
-    {('c'), QLatin1String("cosh")},
-    {('c'), QLatin1String("cos")},
-    {('e'), QLatin1String("exit")},
-    {('e'), QLatin1String("exp")},
-    {('f'), QLatin1String("fabs")},
-    {('f'), QLatin1String("floor")},
-    {('f'), QLatin1String("fmod")},
-    {('f'), QLatin1String("fprintf")},
-    {('f'), QLatin1String("fputs")},
-    {('f'), QLatin1String("free")},
-    {('f'), QLatin1String("frexp")},
-    {('f'), QLatin1String("fscanf")},
-    {('f'), QLatin1String("future")},
-    {('i'), QLatin1String("isalnum")},
-    {('i'), QLatin1String("isalpha")},
-    {('i'), QLatin1String("iscntrl")},
-    {('i'), QLatin1String("isdigit")},
-    {('i'), QLatin1String("isgraph")},
-    {('i'), QLatin1String("islower")},
-    {('i'), QLatin1String("isprint")},
-    {('i'), QLatin1String("ispunct")},
-    {('i'), QLatin1String("isspace")},
-    {('i'), QLatin1String("isupper")},
-    {('i'), QLatin1String("isxdigit")},
-    {('t'), QLatin1String("tolower")},
-    {('t'), QLatin1String("toupper")},
-    {('l'), QLatin1String("labs")},
-    {('l'), QLatin1String("ldexp")},
-    {('l'), QLatin1String("log10")},
-    {('l'), QLatin1String("log")},
-    {('m'), QLatin1String("malloc")},
-    {('r'), QLatin1String("realloc")},
-    {('m'), QLatin1String("main")},
-    {('m'), QLatin1String("memchr")},
-    {('m'), QLatin1String("memcmp")},
-    {('m'), QLatin1String("memcpy")},
-    {('m'), QLatin1String("memset")},
-    {('m'), QLatin1String("modf")},
-    {('p'), QLatin1String("pow")},
-    {('p'), QLatin1String("printf")},
-    {('p'), QLatin1String("putchar")},
-    {('p'), QLatin1String("puts")},
-    {('s'), QLatin1String("scanf")},
-    {('s'), QLatin1String("sinh")},
-    {('s'), QLatin1String("sin")},
-    {('s'), QLatin1String("snprintf")},
-    {('s'), QLatin1String("sprintf")},
-    {('s'), QLatin1String("sqrt")},
-    {('s'), QLatin1String("sscanf")},
-    {('s'), QLatin1String("strcat")},
-    {('s'), QLatin1String("strchr")},
-    {('s'), QLatin1String("strcmp")},
-    {('s'), QLatin1String("strcpy")},
-    {('s'), QLatin1String("strcspn")},
-    {('s'), QLatin1String("strlen")},
-    {('s'), QLatin1String("strncat")},
-    {('s'), QLatin1String("strncmp")},
-    {('s'), QLatin1String("strncpy")},
-    {('s'), QLatin1String("strpbrk")},
-    {('s'), QLatin1String("strrchr")},
-    {('s'), QLatin1String("strspn")},
-    {('s'), QLatin1String("strstr")},
-    {('t'), QLatin1String("tanh")},
-    {('t'), QLatin1String("tan")},
-    {('v'), QLatin1String("vfprintf")},
-    {('v'), QLatin1String("vprintf")},
-    {('v'), QLatin1String("vsprintf")},
-    {('e'), QLatin1String("endl")},
-    {('i'), QLatin1String("initializer_list")},
-    {('u'), QLatin1String("unique_ptr")},
-    {('c'), QLatin1String("complex")},
-    {('i'), QLatin1String("imaginary")}
-};
-
-static const QMultiHash<char, QLatin1String> cpp_other = {
-    {('d'), QLatin1String("define")},
-    {('e'), QLatin1String("else")},
-    {('e'), QLatin1String("elif")},
-    {('e'), QLatin1String("endif")},
-    {('e'), QLatin1String("error")},
-    {('i'), QLatin1String("if")},
-    {('i'), QLatin1String("ifdef")},
-    {('i'), QLatin1String("ifndef")},
-    {('i'), QLatin1String("include")},
-    {('l'), QLatin1String("line")},
-    {('p'), QLatin1String("pragma")},
-    {('P'), QLatin1String("_Pragma")},
-    {('u'), QLatin1String("undef")},
-    {('w'), QLatin1String("warning")}
-};
-
-void loadCppData(QMultiHash<char, QLatin1String> &typess,
-             QMultiHash<char, QLatin1String> &keywordss,
-             QMultiHash<char, QLatin1String> &builtins,
-             QMultiHash<char, QLatin1String> &literalss,
-             QMultiHash<char, QLatin1String> &others){
-    typess = cpp_types;
-    keywordss = cpp_keywords;
-    builtins = cpp_builtin;
-    literalss = cpp_literals;
-    others = cpp_other;
-
-}
+static constexpr KeywordTable::Word cpp_words[] = {
+    {"NULL", KeywordTable::Literal},
+    {"QMap", KeywordTable::Type},
+    {"QHash", KeywordTable::Type},
+    {"QList", KeywordTable::Type},
+    {"QString", KeywordTable::Type},
+    {"QVector", KeywordTable::Type},
+    {"_Pragma", KeywordTable::Other},
+    {"abs", KeywordTable::BuiltIn},
+    {"asm", KeywordTable::Keyword},
+    {"acos", KeywordTable::BuiltIn},
+    {"asin", KeywordTable::BuiltIn},
+    {"atan", KeywordTable::BuiltIn},
+    {"auto", KeywordTable::Keyword},
+    {"abort", KeywordTable::BuiltIn},
+    {"array", KeywordTable::BuiltIn},
+    {"atan2", KeywordTable::BuiltIn},
+    {"auto_ptr", KeywordTable::BuiltIn},
+    {"bool", KeywordTable::Type},
+    {"break", KeywordTable::Keyword},
+    {"bitset", KeywordTable::BuiltIn},
+    {"cin", KeywordTable::BuiltIn},
+    {"cos", KeywordTable::BuiltIn},
+    {"case", KeywordTable::Keyword},
+    {"ceil", KeywordTable::BuiltIn},
+    {"cerr", KeywordTable::BuiltIn},
+    {"char", KeywordTable::Type},
+    {"clog", KeywordTable::BuiltIn},
+    {"cosh", KeywordTable::BuiltIn},
+    {"cout", KeywordTable::BuiltIn},
+    {"catch", KeywordTable::Keyword},
+    {"class", KeywordTable::Type},
+    {"const", KeywordTable::Keyword},
+    {"calloc", KeywordTable::BuiltIn},
+    {"complex", KeywordTable::BuiltIn},
+    {"continue", KeywordTable::Keyword},
+    {"const_cast", KeywordTable::Keyword},
+    {"do", KeywordTable::Keyword},
+    {"deque", KeywordTable::BuiltIn},
+    {"define", KeywordTable::Other},
+    {"delete", KeywordTable::Keyword},
+    {"double", KeywordTable::Type},
+    {"default", KeywordTable::Keyword},
+    {"dynamic_cast", KeywordTable::Keyword},
+    {"exp", KeywordTable::BuiltIn},
+    {"elif", KeywordTable::Other},
+    {"else", KeywordTable::Keyword},
+    {"endl", KeywordTable::BuiltIn},
+    {"enum", KeywordTable::Type},
+    {"exit", KeywordTable::BuiltIn},
+    {"endif", KeywordTable::Other},
+    {"error", KeywordTable::Other},
+    {"explicit", KeywordTable::Keyword},
+    {"for", KeywordTable::Keyword},
+    {"fabs", KeywordTable::BuiltIn},
+    {"fmod", KeywordTable::BuiltIn},
+    {"free", KeywordTable::BuiltIn},
+    {"false", KeywordTable::Literal},
+    {"float", KeywordTable::Type},
+    {"floor", KeywordTable::BuiltIn},
+    {"fputs", KeywordTable::BuiltIn},
+    {"frexp", KeywordTable::BuiltIn},
+    {"fscanf", KeywordTable::BuiltIn},
+    {"future", KeywordTable::BuiltIn},
+    {"fprintf", KeywordTable::BuiltIn},
+    {"goto", KeywordTable::Keyword},
+    {"if", KeywordTable::Keyword},
+    {"int", KeywordTable::Type},
+    {"ifdef", KeywordTable::Other},
+    {"ifndef", KeywordTable::Other},
+    {"include", KeywordTable::Other},
+    {"isalnum", KeywordTable::BuiltIn},
+    {"isalpha", KeywordTable::BuiltIn},
+    {"iscntrl", KeywordTable::BuiltIn},
+    {"isdigit", KeywordTable::BuiltIn},
+    {"isgraph", KeywordTable::BuiltIn},
+    {"islower", KeywordTable::BuiltIn},
+    {"isprint", KeywordTable::BuiltIn},
+    {"ispunct", KeywordTable::BuiltIn},
+    {"isspace", KeywordTable::BuiltIn},
+    {"isupper", KeywordTable::BuiltIn},
+    {"isxdigit", KeywordTable::BuiltIn},
+    {"imaginary", KeywordTable::BuiltIn},
+    {"istringstream", KeywordTable::BuiltIn},
+    {"initializer_list", KeywordTable::BuiltIn},
+    {"log", KeywordTable::BuiltIn},
+    {"labs", KeywordTable::BuiltIn},
+    {"line", KeywordTable::Other},
+    {"list", KeywordTable::BuiltIn},
+    {"long", KeywordTable::Type},
+    {"ldexp", KeywordTable::BuiltIn},
+    {"log10", KeywordTable::BuiltIn},
+    {"map", KeywordTable::BuiltIn},
+    {"main", KeywordTable::BuiltIn},
+    {"modf", KeywordTable::BuiltIn},
+    {"malloc", KeywordTable::BuiltIn},
+    {"memchr", KeywordTable::BuiltIn},
+    {"memcmp", KeywordTable::BuiltIn},
+    {"memcpy", KeywordTable::BuiltIn},
+    {"memset", KeywordTable::BuiltIn},
+    {"mutable", KeywordTable::Keyword},
+    {"multimap", KeywordTable::BuiltIn},
+    {"multiset", KeywordTable::BuiltIn},
+    {"new", KeywordTable::Keyword},
+    {"nullptr", KeywordTable::Literal},
+    {"namespace", KeywordTable::Keyword},
+    {"operator", KeywordTable::Keyword},
+    {"ostringstream", KeywordTable::BuiltIn},
+    {"pow", KeywordTable::BuiltIn},
+    {"puts", KeywordTable::BuiltIn},
+    {"pragma", KeywordTable::Other},
+    {"printf", KeywordTable::BuiltIn},
+    {"public", KeywordTable::Keyword},
+    {"private", KeywordTable::Keyword},
+    {"putchar", KeywordTable::BuiltIn},
+    {"protected", KeywordTable::Keyword},
+    {"queue", KeywordTable::BuiltIn},
+    {"return", KeywordTable::Keyword},
+    {"realloc", KeywordTable::BuiltIn},
+    {"register", KeywordTable::Keyword},
+    {"reinterpret_cast", KeywordTable::Keyword},
+    {"set", KeywordTable::BuiltIn},
+    {"sin", KeywordTable::BuiltIn},
+    {"std", KeywordTable::BuiltIn},
+    {"sinh", KeywordTable::BuiltIn},
+    {"slot", KeywordTable::Keyword},
+    {"sqrt", KeywordTable::BuiltIn},
+    {"scanf", KeywordTable::BuiltIn},
+    {"short", KeywordTable::Type},
+    {"stack", KeywordTable::BuiltIn},
+    {"stdin", KeywordTable::BuiltIn},
+    {"signal", KeywordTable::Keyword},
+    {"signed", KeywordTable::Keyword},
+    {"size_t", KeywordTable::Type},
+    {"sizeof", KeywordTable::Keyword},
+    {"sscanf", KeywordTable::BuiltIn},
+    {"static", KeywordTable::Keyword},
+    {"stderr", KeywordTable::BuiltIn},
+    {"stdout", KeywordTable::BuiltIn},
+    {"strcat", KeywordTable::BuiltIn},
+    {"strchr", KeywordTable::BuiltIn},
+    {"strcmp", KeywordTable::BuiltIn},
+    {"strcpy", KeywordTable::BuiltIn},
+    {"string", KeywordTable::BuiltIn},
+    {"strlen", KeywordTable::BuiltIn},
+    {"strspn", KeywordTable::BuiltIn},
+    {"strstr", KeywordTable::BuiltIn},
+    {"struct", KeywordTable::Type},
+    {"switch", KeywordTable::Keyword},
+    {"sprintf", KeywordTable::BuiltIn},
+    {"ssize_t", KeywordTable::Type},
+    {"strcspn", KeywordTable::BuiltIn},
+    {"strncat", KeywordTable::BuiltIn},
+    {"strncmp", KeywordTable::BuiltIn},
+    {"strncpy", KeywordTable::BuiltIn},
+    {"strpbrk", KeywordTable::BuiltIn},
+    {"strrchr", KeywordTable::BuiltIn},
+    {"snprintf", KeywordTable::BuiltIn},
+    {"shared_ptr", KeywordTable::BuiltIn},
+    {"static_cast", KeywordTable::Keyword},
+    {"stringstream", KeywordTable::BuiltIn},
+    {"tan", KeywordTable::BuiltIn},
+    {"try", KeywordTable::Keyword},
+    {"tanh", KeywordTable::BuiltIn},
+    {"this", KeywordTable::Keyword},
+    {"true", KeywordTable::Literal},
+    {"throw", KeywordTable::Keyword},
+    {"tolower", KeywordTable::BuiltIn},
+    {"toupper", KeywordTable::BuiltIn},
+    {"typedef", KeywordTable::Keyword},
+    {"template", KeywordTable::Keyword},
+    {"terminate", KeywordTable::BuiltIn},
+    {"undef", KeywordTable::Other},
+    {"union", KeywordTable::Type},
+    {"using", KeywordTable::Keyword},
+    {"uint8_t", KeywordTable::Type},
+    {"uint16_t", KeywordTable::Type},
+    {"uint32_t", KeywordTable::Type},
+    {"uint64_t", KeywordTable::Type},
+    {"unsigned", KeywordTable::Keyword},
+    {"unique_ptr", KeywordTable::BuiltIn},
+    {"unordered_map", KeywordTable::BuiltIn},
+    {"unordered_set", KeywordTable::BuiltIn},
+    {"unordered_multimap", KeywordTable::BuiltIn},
+    {"unordered_multiset", KeywordTable::BuiltIn},
+    {"void", KeywordTable::Type},
+    {"vector", KeywordTable::BuiltIn},
+    {"vprintf", KeywordTable::BuiltIn},
+    {"vfprintf", KeywordTable::BuiltIn},
+    {"volatile", KeywordTable::Keyword},
+    {"vsprintf", KeywordTable::BuiltIn},
+    {"while", KeywordTable::Keyword},
+    {"warning", KeywordTable::Other},
+    {"wchar_t", KeywordTable::Type},
+    {"wstring", KeywordTable::BuiltIn}
+};
+static_assert(KeywordTable::isSorted(cpp_words), "cpp_words isn't sorted");
+static constexpr KeywordTable cppWords(cpp_words);
 
 /**********************************************************/
 /* Shell Data *********************************************/
 /**********************************************************/
 
-static const QMultiHash<char, QLatin1String> shell_keywords = {
-    {('i'), QLatin1String("if")},
-    {('t'), QLatin1String("then")},
-    {('e'), QLatin1String("else")},
-    {('e'), QLatin1String("elif")},
-    {('f'), QLatin1String("fi")},
-    {('f'), QLatin1String("for")},
-    {('w'), QLatin1String("while")},
-    {('i'), QLatin1String("in")},
-    {('d'), QLatin1String("do")},
-    {('d'), QLatin1String("done")},
-    {('c'), QLatin1String("case")},
-    {('e'), QLatin1String("esac")},
-    {('f'), QLatin1String("function")}
-};
-
-static const QMultiHash<char, QLatin1String> shell_types = {
-};
-
-static const QMultiHash<char, QLatin1String> shell_literals = {
-    {('f'), QLatin1String("false")},
-    {('t'), QLatin1String("true")}
-};
-
-static const QMultiHash<char, QLatin1String> shell_builtin = {
-    {('b'), QLatin1String("break")},
-    {('c'), QLatin1String("cd")},
-    {('c'), QLatin1String("continue")},
-    {('e'), QLatin1String("eval")},
-    {('e'), QLatin1String("exec")},
-    {('e'), QLatin1String("exit")},
-    {('e'), QLatin1String("export")},
-    {('g'), QLatin1String("getopts")},
-    {('h'), QLatin1String("hash")},
-    {('p'), QLatin1String("pwd")},
-    {('r'), QLatin1String("readonly")},
-    {('r'), QLatin1String("return")},
-    {('s'), QLatin1String("shift")},
-    {('t'), QLatin1String("test")},
-    {('t'), QLatin1String("timestrap")},
-    {('u'), QLatin1String("umask")},
-    {('u'), QLatin1String("unset")},
-    {('B'), QLatin1String("Bash")},
-    {('a'), QLatin1String("alias")},
-    {('b'), QLatin1String("bind")},
-    {('b'), QLatin1String("builtin")},
-    {('c'), QLatin1String("caller")},
-    {('c'), QLatin1String("command")},
-    {('d'), QLatin1String("declare")},
-    {('e'), QLatin1String("echo")},
-    {('e'), QLatin1String("enable")},
-    {('h'), QLatin1String("help")},
-    {('l'), QLatin1String("let")},
-    {('l'), QLatin1String("local")},
-    {('l'), QLatin1String("logout")},
-    {('m'), QLatin1String("mapfile")},
-    {('p'), QLatin1String("printfread")},
-    {('r'), QLatin1String("readarray")},
-    {('s'), QLatin1String("source")},
-    {('t'), QLatin1String("type")},
-    {('t'), QLatin1String("typeset")},
-    {('u'), QLatin1String("ulimit")},
-    {('u'), QLatin1String("unalias")},
-    {('m'), QLatin1String("modifiers")},
-    {('s'), QLatin1String("set")},
-    {('s'), QLatin1String("shopt")},
-    {('a'), QLatin1String("autoload")},
-    {('b'), QLatin1String("bg")},
-    {('b'), QLatin1String("bindkey")},
-    {('b'), QLatin1String("bye")},
-    {('c'), QLatin1String("cap")},
-    {('c'), QLatin1String("chdir")},
-    {('c'), QLatin1String("clone")},
-    {('c'), QLatin1String("comparguments")},
-    {('c'), QLatin1String("compcall")},
-    {('c'), QLatin1String("compctl")},
-    {('c'), QLatin1String("compdescribe")},
-    {('c'), QLatin1String("compfilescompgroups")},
-    {('c'), QLatin1String("compquote")},
-    {('c'), QLatin1String("comptags")},
-    {('c'), QLatin1String("comptry")},
-    {('c'), QLatin1String("compvalues")},
-    {('d'), QLatin1String("dirs")},
-    {('d'), QLatin1String("disable")},
-    {('d'), QLatin1String("disown")},
-    {('e'), QLatin1String("echotc")},
-    {('e'), QLatin1String("echoti")},
-    {('e'), QLatin1String("emulatefc")},
-    {('f'), QLatin1String("fg")},
-    {('f'), QLatin1String("float")},
-    {('f'), QLatin1String("functions")},
-    {('g'), QLatin1String("getcap")},
-    {('g'), QLatin1String("getln")},
-    {('h'), QLatin1String("history")},
-    {('i'), QLatin1String("integer")},
-    {('j'), QLatin1String("jobs")},
-    {('k'), QLatin1String("kill")},
-    {('l'), QLatin1String("limit")},
-    {('l'), QLatin1String("log")},
-    {('n'), QLatin1String("noglob")},
-    {('p'), QLatin1String("popd")},
-    {('p'), QLatin1String("printpushd")},
-    {('p'), QLatin1String("pushln")},
-    {('r'), QLatin1String("rehash")},
-    {('s'), QLatin1String("sched")},
-    {('s'), QLatin1String("setcap")},
-    {('s'), QLatin1String("setopt")},
-    {('s'), QLatin1String("stat")},
-    {('s'), QLatin1String("suspend")},
-    {('t'), QLatin1String("ttyctl")},
-    {('u'), QLatin1String("unfunction")},
-    {('u'), QLatin1String("unhash")},
-    {('u'), QLatin1String("unlimitunsetopt")},
-    {('v'), QLatin1String("vared")},
-    {('w'), QLatin1String("wait")},
-    {('w'), QLatin1String("whence")},
-    {('w'), QLatin1String("where")},
-    {('w'), QLatin1String("which")},
-    {('z'), QLatin1String("zcompile")},
-    {('z'), QLatin1String("zformat")},
-    {('z'), QLatin1String("zftp")},
-    {('z'), QLatin1String("zle")},
-    {('z'), QLatin1String("zmodload")},
-    {('z'), QLatin1String("zparseopts")},
-    {('z'), QLatin1String("zprof")},
-    {('z'), QLatin1String("zpty")},
-    {('z'), QLatin1String("zregexparse")},
-    {('z'), QLatin1String("zsocket")},
-    {('z'), QLatin1String("zstyle")},
-    {('z'), QLatin1String("ztcp")}
-};
-
-static const QMultiHash<char, QLatin1String> shell_other = {
-};
-
-void loadShellData(QMultiHash<char, QLatin1String> &types,
-             QMultiHash<char, QLatin1String> &keywords,
-             QMultiHash<char, QLatin1String> &builtin,
-             QMultiHash<char, QLatin1String> &literals,
-             QMultiHash<char, QLatin1String> &other){
-    types = shell_types;
-    keywords = shell_keywords;
-    builtin = shell_builtin;
-    literals = shell_literals;
-    other = shell_other;
-
-}
+static constexpr KeywordTable::Word shell_words[] = {
+    {"Bash", KeywordTable::BuiltIn},
+    {"alias", KeywordTable::BuiltIn},
+    {"autoload", KeywordTable::BuiltIn},
+    {"bg", KeywordTable::BuiltIn},
+    {"bye", KeywordTable::BuiltIn},
+    {"bind", KeywordTable::BuiltIn},
+    {"break", KeywordTable::BuiltIn},
+    {"bindkey", KeywordTable::BuiltIn},
+    {"builtin", KeywordTable::BuiltIn},
+    {"cd", KeywordTable::BuiltIn},
+    {"cap", KeywordTable::BuiltIn},
+    {"case", KeywordTable::Keyword},
+    {"chdir", KeywordTable::BuiltIn},
+    {"clone", KeywordTable::BuiltIn},
+    {"caller", KeywordTable::BuiltIn},
+    {"command", KeywordTable::BuiltIn},
+    {"compctl", KeywordTable::BuiltIn},
+    {"comptry", KeywordTable::BuiltIn},
+    {"compcall", KeywordTable::BuiltIn},
+    {"comptags", KeywordTable::BuiltIn},
+    {"continue", KeywordTable::BuiltIn},
+    {"compquote", KeywordTable::BuiltIn},
+    {"compvalues", KeywordTable::BuiltIn},
+    {"compdescribe", KeywordTable::BuiltIn},
+    {"comparguments", KeywordTable::BuiltIn},
+    {"compfilescompgroups", KeywordTable::BuiltIn},
+    {"do", KeywordTable::Keyword},
+    {"dirs", KeywordTable::BuiltIn},
+    {"done", KeywordTable::Keyword},
+    {"disown", KeywordTable::BuiltIn},
+    {"declare", KeywordTable::BuiltIn},
+    {"disable", KeywordTable::BuiltIn},
+    {"echo", KeywordTable::BuiltIn},
+    {"elif", KeywordTable::Keyword},
+    {"else", KeywordTable::Keyword},
+    {"esac", KeywordTable::Keyword},
+    {"eval", KeywordTable::BuiltIn},
+    {"exec", KeywordTable::BuiltIn},
+    {"exit", KeywordTable::BuiltIn},
+    {"echotc", KeywordTable::BuiltIn},
+    {"echoti", KeywordTable::BuiltIn},
+    {"enable", KeywordTable::BuiltIn},
+    {"export", KeywordTable::BuiltIn},
+    {"emulatefc", KeywordTable::BuiltIn},
+    {"fg", KeywordTable::BuiltIn},
+    {"fi", KeywordTable::Keyword},
+    {"for", KeywordTable::Keyword},
+    {"false", KeywordTable::Literal},
+    {"float", KeywordTable::BuiltIn},
+    {"function", KeywordTable::Keyword},
+    {"functions", KeywordTable::BuiltIn},
+    {"getln", KeywordTable::BuiltIn},
+    {"getcap", KeywordTable::BuiltIn},
+    {"getopts", KeywordTable::BuiltIn},
+    {"hash", KeywordTable::BuiltIn},
+    {"help", KeywordTable::BuiltIn},
+    {"history", KeywordTable::BuiltIn},
+    {"if", KeywordTable::Keyword},
+    {"in", KeywordTable::Keyword},
+    {"integer", KeywordTable::BuiltIn},
+    {"jobs", KeywordTable::BuiltIn},
+    {"kill", KeywordTable::BuiltIn},
+    {"let", KeywordTable::BuiltIn},
+    {"log", KeywordTable::BuiltIn},
+    {"limit", KeywordTable::BuiltIn},
+    {"local", KeywordTable::BuiltIn},
+    {"logout", KeywordTable::BuiltIn},
+    {"mapfile", KeywordTable::BuiltIn},
+    {"modifiers", KeywordTable::BuiltIn},
+    {"noglob", KeywordTable::BuiltIn},
+    {"pwd", KeywordTable::BuiltIn},
+    {"popd", KeywordTable::BuiltIn},
+    {"pushln", KeywordTable::BuiltIn},
+    {"printfread", KeywordTable::BuiltIn},
+    {"printpushd", KeywordTable::BuiltIn},
+    {"rehash", KeywordTable::BuiltIn},
+    {"return", KeywordTable::BuiltIn},
+    {"readonly", KeywordTable::BuiltIn},
+    {"readarray", KeywordTable::BuiltIn},
+    {"set", KeywordTable::BuiltIn},
+    {"stat", KeywordTable::BuiltIn},
+    {"sched", KeywordTable::BuiltIn},
+    {"shift", KeywordTable::BuiltIn},
+    {"shopt", KeywordTable::BuiltIn},
+    {"setcap", KeywordTable::BuiltIn},
+    {"setopt", KeywordTable::BuiltIn},
+    {"source", KeywordTable::BuiltIn},
+    {"suspend", KeywordTable::BuiltIn},
+    {"test", KeywordTable::BuiltIn},
+    {"then", KeywordTable::Keyword},
+    {"true", KeywordTable::Literal},
+    {"type", KeywordTable::BuiltIn},
+    {"ttyctl", KeywordTable::BuiltIn},
+    {"typeset", KeywordTable::BuiltIn},
+    {"timestrap", KeywordTable::BuiltIn},
+    {"umask", KeywordTable::BuiltIn},
+    {"unset", KeywordTable::BuiltIn},
+    {"ulimit", KeywordTable::BuiltIn},
+    {"unhash", KeywordTable::BuiltIn},
+    {"unalias", KeywordTable::BuiltIn},
+    {"unfunction", KeywordTable::BuiltIn},
+    {"unlimitunsetopt", KeywordTable::BuiltIn},
+    {"vared", KeywordTable::BuiltIn},
+    {"wait", KeywordTable::BuiltIn},
+    {"where", KeywordTable::BuiltIn},
+    {"which", KeywordTable::BuiltIn},
+    {"while", KeywordTable::Keyword},
+    {"whence", KeywordTable::BuiltIn},
+    {"zle", KeywordTable::BuiltIn},
+    {"zftp", KeywordTable::BuiltIn},
+    {"zpty", KeywordTable::BuiltIn},
+    {"ztcp", KeywordTable::BuiltIn},
+    {"zprof", KeywordTable::BuiltIn},
+    {"zstyle", KeywordTable::BuiltIn},
+    {"zformat", KeywordTable::BuiltIn},
+    {"zsocket", KeywordTable::BuiltIn},
+    {"zcompile", KeywordTable::BuiltIn},
+    {"zmodload", KeywordTable::BuiltIn},
+    {"zparseopts", KeywordTable::BuiltIn},
+    {"zregexparse", KeywordTable::BuiltIn}
+};
+static_assert(KeywordTable::isSorted(shell_words), "shell_words isn't sorted");
+static constexpr KeywordTable shellWords(shell_words);
 
 /**********************************************************/
 /* JS Data *********************************************/
 /**********************************************************/
 
-static const QMultiHash<char, QLatin1String> js_keywords = {
-    {('i'), QLatin1String("in")},
-    {('o'), QLatin1String("of")},
-    {('i'), QLatin1String("if")},
-    {('f'), QLatin1String("for")},
-    {('w'), QLatin1String("while")},
-    {('f'), QLatin1String("finally")},
-    {('n'), QLatin1String("new")},
-    {('f'), QLatin1String("function")},
-    {('d'), QLatin1String("do")},
-    {('r'), QLatin1String("return")},
-    {('v'), QLatin1String("void")},
-    {('e'), QLatin1String("else")},
-    {('b'), QLatin1String("break")},
-    {('c'), QLatin1String("catch")},
-    {('i'), QLatin1String("instanceof")},
-    {('w'), QLatin1String("with")},
-    {('t'), QLatin1String("throw")},
-    {('c'), QLatin1String("case")},
-    {('d'), QLatin1String("default")},
-    {('t'), QLatin1String("try")},
-    {('t'), QLatin1String("this")},
-    {('s'), QLatin1String("switch")},
-    {('c'), QLatin1String("continue")},
-    {('t'), QLatin1String("typeof")},
-    {('d'), QLatin1String("delete")},
-    {('l'), QLatin1String("let")},
-    {('y'), QLatin1String("yield")},
-    {('c'), QLatin1String("const")},
-    {('e'), QLatin1String("export")},
-    {('s'), QLatin1String("super")},
-    {('d'), QLatin1String("debugger")},
-    {('a'), QLatin1String("as")},
-    {('a'), QLatin1String("async")},
-    {('a'), QLatin1String("await")},
-    {('s'), QLatin1String("static")},
-    {('i'), QLatin1String("import")},
-    {('f'), QLatin1String("from")},
-    {('a'), QLatin1String("as")}
-};
-
-static const QMultiHash<char, QLatin1String> js_types = {
-    {('v'), QLatin1String("var")},
-    {('c'), QLatin1String("class")},
-    {('b'), QLatin1String("byte")},
-    {('e'), QLatin1String("enum")},
-    {('f'), QLatin1String("float")},
-    {('s'), QLatin1String("short")},
-    {('l'), QLatin1String("long")},
-    {('i'), QLatin1String("int")},
-    {('v'), QLatin1String("void")},
-    {('b'), QLatin1String("boolean")},
-    {('d'), QLatin1String("double")}
-};
-
-static const QMultiHash<char, QLatin1String> js_literals = {
-    {('f'), QLatin1String("false")},
-    {('n'), QLatin1String("null")},
-    {('t'), QLatin1String("true")},
-    {('u'), QLatin1String("undefined")},
-    {('N'), QLatin1String("NaN")},
-    {('I'), QLatin1String("Infinity")}
-};
-
-static const QMultiHash<char, QLatin1String> js_builtin = {
-    {('e'), QLatin1String("eval")},
-    {('i'), QLatin1String("isFinite")},
-    {('i'), QLatin1String("isNaN")},
-    {('p'), QLatin1String("parseFloat")},
-    {('p'), QLatin1String("parseInt")},
-    {('d'), QLatin1String("decodeURI")},
-    {('d'), QLatin1String("decodeURIComponent")},
-    {('e'), QLatin1String("encodeURI")},
-    {('e'), QLatin1String("encodeURIComponent")},
-    {('e'), QLatin1String("escape")},
-    {('u'), QLatin1String("unescape")},
-    {('O'), QLatin1String("Object")},
-    {('F'), QLatin1String("Function")},
-    {('B'), QLatin1String("Boolean")},
-    {('E'), QLatin1String("Error")},
-    {('E'), QLatin1String("EvalError")},
-    {('I'), QLatin1String("InternalError")},
-    {('R'), QLatin1String("RangeError")},
-    {('R'), QLatin1String("ReferenceError")},
-    {('S'), QLatin1String("StopIteration")},
-    {('S'), QLatin1String("SyntaxError")},
-    {('T'), QLatin1String("TypeError")},
-    {('U'), QLatin1String("URIError")},
-    {('N'), QLatin1String("Number")},
-    {('M'), QLatin1String("Math")},
-    {('D'), QLatin1String("Date")},
-    {('S'), QLatin1String("String")},
-    {('R'), QLatin1String("RegExp")},
-    {('A'), QLatin1String("Array")},
-    {('F'), QLatin1String("Float32Array")},
-    {('F'), QLatin1String("Float64Array")},
-    {('I'), QLatin1String("Int16Array")},
-    {('I'), QLatin1String("Int32Array")},
-    {('I'), QLatin1String("Int8Array")},
-    {('U'), QLatin1String("Uint16Array")},
-    {('U'), QLatin1String("Uint32Array")},
-    {('U'), QLatin1String("Uint8Array")},
-    {('U'), QLatin1String("Uint8ClampedArray")},
-    {('A'), QLatin1String("ArrayBuffer")},
-    {('D'), QLatin1String("DataView")},
-    {('J'), QLatin1String("JSON")},
-    {('I'), QLatin1String("Intl")},
-    {('a'), QLatin1String("arguments")},
-    {('r'), QLatin1String("require")},
-    {('m'), QLatin1String("module")},
-    {('c'), QLatin1String("console")},
-    {('w'), QLatin1String("window")},
-    {('d'), QLatin1String("document")},
-    {('S'), QLatin1String("Symbol")},
-    {('S'), QLatin1String("Set")},
-    {('M'), QLatin1String("Map")},
-    {('W'), QLatin1String("WeakSet")},
-    {('W'), QLatin1String("WeakMap")},
-    {('P'), QLatin1String("Proxy")},
-    {('R'), QLatin1String("Reflect")},
-    {('P'), QLatin1String("Promise")}
-};
-
-static const QMultiHash<char, QLatin1String> js_other = {
-};
-
-void loadJSData(QMultiHash<char, QLatin1String> &types,
-             QMultiHash<char, QLatin1String> &keywords,
-             QMultiHash<char, QLatin1String> &builtin,
-             QMultiHash<char, QLatin1String> &literals,
-             QMultiHash<char, QLatin1String> &other){
-    types = js_types;
-    keywords = js_keywords;
-    builtin = js_builtin;
-    literals = js_literals;
-    other = js_other;
-}
+static constexpr KeywordTable::Word js_words[] = {
+    {"Array", KeywordTable::BuiltIn},
+    {"ArrayBuffer", KeywordTable::BuiltIn},
+    {"Boolean", KeywordTable::BuiltIn},
+    {"Date", KeywordTable::BuiltIn},
+    {"DataView", KeywordTable::BuiltIn},
+    {"Error", KeywordTable::BuiltIn},
+    {"EvalError", KeywordTable::BuiltIn},
+    {"Function", KeywordTable::BuiltIn},
+    {"Float32Array", KeywordTable::BuiltIn},
+    {"Float64Array", KeywordTable::BuiltIn},
+    {"Intl", KeywordTable::BuiltIn},
+    {"Infinity", KeywordTable::Literal},
+    {"Int8Array", KeywordTable::BuiltIn},
+    {"Int16Array", KeywordTable::BuiltIn},
+    {"Int32Array", KeywordTable::BuiltIn},
+    {"InternalError", KeywordTable::BuiltIn},
+    {"JSON", KeywordTable::BuiltIn},
+    {"Map", KeywordTable::BuiltIn},
+    {"Math", KeywordTable::BuiltIn},
+    {"NaN", KeywordTable::Literal},
+    {"Number", KeywordTable::BuiltIn},
+    {"Object", KeywordTable::BuiltIn},
+    {"Proxy", KeywordTable::BuiltIn},
+    {"Promise", KeywordTable::BuiltIn},
+    {"RegExp", KeywordTable::BuiltIn},
+    {"Reflect", KeywordTable::BuiltIn},
+    {"RangeError", KeywordTable::BuiltIn},
+    {"ReferenceError", KeywordTable::BuiltIn},
+    {"Set", KeywordTable::BuiltIn},
+    {"String", KeywordTable::BuiltIn},
+    {"Symbol", KeywordTable::BuiltIn},
+    {"SyntaxError", KeywordTable::BuiltIn},
+    {"StopIteration", KeywordTable::BuiltIn},
+    {"TypeError", KeywordTable::BuiltIn},
+    {"URIError", KeywordTable::BuiltIn},
+    {"Uint8Array", KeywordTable::BuiltIn},
+    {"Uint16Array", KeywordTable::BuiltIn},
+    {"Uint32Array", KeywordTable::BuiltIn},
+    {"Uint8ClampedArray", KeywordTable::BuiltIn},
+    {"WeakMap", KeywordTable::BuiltIn},
+    {"WeakSet", KeywordTable::BuiltIn},
+    {"as", KeywordTable::Keyword},
+    {"async", KeywordTable::Keyword},
+    {"await", KeywordTable::Keyword},
+    {"arguments", KeywordTable::BuiltIn},
+    {"byte", KeywordTable::Type},
+    {"break", KeywordTable::Keyword},
+    {"boolean", KeywordTable::Type},
+    {"case", KeywordTable::Keyword},
+    {"catch", KeywordTable::Keyword},
+    {"class", KeywordTable::Type},
+    {"const", KeywordTable::Keyword},
+    {"console", KeywordTable::BuiltIn},
+    {"continue", KeywordTable::Keyword},
+    {"do", KeywordTable::Keyword},
+    {"delete", KeywordTable::Keyword},
+    {"double", KeywordTable::Type},
+    {"default", KeywordTable::Keyword},
+    {"debugger", KeywordTable::Keyword},
+    {"document", KeywordTable::BuiltIn},
+    {"decodeURI", KeywordTable::BuiltIn},
+    {"decodeURIComponent", KeywordTable::BuiltIn},
+    {"else", KeywordTable::Keyword},
+    {"enum", KeywordTable::Type},
+    {"eval", KeywordTable::BuiltIn},
+    {"escape", KeywordTable::BuiltIn},
+    {"export", KeywordTable::Keyword},
+    {"encodeURI", KeywordTable::BuiltIn},
+    {"encodeURIComponent", KeywordTable::BuiltIn},
+    {"for", KeywordTable::Keyword},
+    {"from", KeywordTable::Keyword},
+    {"false", KeywordTable::Literal},
+    {"float", KeywordTable::Type},
+    {"finally", KeywordTable::Keyword},
+    {"function", KeywordTable::Keyword},
+    {"if", KeywordTable::Keyword},
+    {"in", KeywordTable::Keyword},
+    {"int", KeywordTable::Type},
+    {"isNaN", KeywordTable::BuiltIn},
+    {"import", KeywordTable::Keyword},
+    {"isFinite", KeywordTable::BuiltIn},
+    {"instanceof", KeywordTable::Keyword},
+    {"let", KeywordTable::Keyword},
+    {"long", KeywordTable::Type},
+    {"module", KeywordTable::BuiltIn},
+    {"new", KeywordTable::Keyword},
+    {"null", KeywordTable::Literal},
+    {"of", KeywordTable::Keyword},
+    {"parseInt", KeywordTable::BuiltIn},
+    {"parseFloat", KeywordTable::BuiltIn},
+    {"return", KeywordTable::Keyword},
+    {"require", KeywordTable::BuiltIn},
+    {"short", KeywordTable::Type},
+    {"super", KeywordTable::Keyword},
+    {"static", KeywordTable::Keyword},
+    {"switch", KeywordTable::Keyword},
+    {"try", KeywordTable::Keyword},
+    {"this", KeywordTable::Keyword},
+    {"true", KeywordTable::Literal},
+    {"throw", KeywordTable::Keyword},
+    {"typeof", KeywordTable::Keyword},
+    {"unescape", KeywordTable::BuiltIn},
+    {"undefined", KeywordTable::Literal},
+    {"var", KeywordTable::Type},
+    {"void", KeywordTable::Type},
+    {"with", KeywordTable::Keyword},
+    {"while", KeywordTable::Keyword},
+    {"window", KeywordTable::BuiltIn},
+    {"yield", KeywordTable::Keyword}
+};
+static_assert(KeywordTable::isSorted(js_words), "js_words isn't sorted");
+static constexpr KeywordTable jsWords(js_words);
 
 /**********************************************************/
 /* PHP Data *********************************************/
 /**********************************************************/
 
-static const QMultiHash<char, QLatin1String> php_keywords = {
-    {('a'), QLatin1String("and")},
-    {('l'), QLatin1String("list")},
-    {('a'), QLatin1String("abstract")},
-    {('g'), QLatin1String("global")},
-    {('p'), QLatin1String("private")},
-    {('e'), QLatin1String("echo")},
-    {('i'), QLatin1String("interface")},
-    {('a'), QLatin1String("as")},
-    {('s'), QLatin1String("static")},
-    {('e'), QLatin1String("endswitch")},
-    {('i'), QLatin1String("if")},
-    {('e'), QLatin1String("endwhile")},
-    {('o'), QLatin1String("or")},
-    {('c'), QLatin1String("const")},
-    {('f'), QLatin1String("for")},
-    {('e'), QLatin1String("endforeach")},
-    {('s'), QLatin1String("self")},
-    {('w'), QLatin1String("while")},
-    {('i'), QLatin1String("isset")},
-    {('p'), QLatin1String("public")},
-    {('p'), QLatin1String("protected")},
-    {('e'), QLatin1String("exit")},
-    {('f'), QLatin1String("foreach")},
-    {('t'), QLatin1String("throw")},
-    {('e'), QLatin1String("elseif")},
-    {('e'), QLatin1String("empty")},
-    {('d'), QLatin1String("do")},
-    {('x'), QLatin1String("xor")},
-    {('r'), QLatin1String("return")},
-    {('p'), QLatin1String("parent")},
-    {('c'), QLatin1String("clone")},
-    {('u'), QLatin1String("use")},
-    {('e'), QLatin1String("else")},
-    {('b'), QLatin1String("break")},
-    {('p'), QLatin1String("print")},
-    {('e'), QLatin1String("eval")},
-    {('n'), QLatin1String("new")},
-    {('c'), QLatin1String("catch")},
-    {('c'), QLatin1String("case")},
-    {('e'), QLatin1String("exception")},
-    {('d'), QLatin1String("default")},
-    {('d'), QLatin1String("die")},
-    {('e'), QLatin1String("enddeclare")},
-    {('f'), QLatin1String("final")},
-    {('t'), QLatin1String("try")},
-    {('s'), QLatin1String("switch")},
-    {('c'), QLatin1String("continue")},
-    {('e'), QLatin1String("endfor")},
-    {('e'), QLatin1String("endif")},
-    {('d'), QLatin1String("declare")},
-    {('u'), QLatin1String("unset")},
-    {('t'), QLatin1String("trait")},
-    {('g'), QLatin1String("goto")},
-    {('i'), QLatin1String("instanceof")},
-    {('i'), QLatin1String("insteadof")},
-    {('y'), QLatin1String("yield")},
-    {('f'), QLatin1String("finally")}
-};
-
-static const QMultiHash<char, QLatin1String> php_types = {
-    {('v'), QLatin1String("var")},
-    {('c'), QLatin1String("class")},
-    {('e'), QLatin1String("enum")},
-    {('a'), QLatin1String("array")}
-};
-
-static const QMultiHash<char, QLatin1String> php_literals = {
-    {('f'), QLatin1String("false")},
-    {('t'), QLatin1String("true")},
-    {('n'), QLatin1String("null")}
-};
-
-static const QMultiHash<char, QLatin1String> php_builtin = {
-
-
-};
-
-static const QMultiHash<char, QLatin1String> php_other = {
-    {('i'), QLatin1String("include_once")},
-    {('i'), QLatin1String("include")},
-    {('_'), QLatin1String("__FILE__")},
-    {('r'), QLatin1String("require")},
-    {('r'), QLatin1String("require_once")},
-    {('_'), QLatin1String("__CLASS__")},
-    {('_'), QLatin1String("__LINE__")},
-    {('_'), QLatin1String("__METHOD__")},
-    {('_'), QLatin1String("__FUNCTION__")},
-    {('_'), QLatin1String("__DIR__")},
-    {('_'), QLatin1String("__NAMESPACE__")},
-
-    {('S'), QLatin1String("SERVER")},
-    {('G'), QLatin1String("GET")},
-    {('P'), QLatin1String("POST")},
-    {('F'), QLatin1String("FILES")},
-    {('R'), QLatin1String("REQUEST")},
-    {('S'), QLatin1String("SESSION")},
-    {('E'), QLatin1String("ENV")},
-    {('C'), QLatin1String("COOKIE")},
-    {('G'), QLatin1String("GLOBALS")},
-    {('H'), QLatin1String("HTTP_RAW_POST_DATA")},
-    {('a'), QLatin1String("argc")},
-    {('a'), QLatin1String("argv")},
-    {('p'), QLatin1String("php_errormsg")},
-    {('h'), QLatin1String("http_response_header")}
-};
-
-void loadPHPData(QMultiHash<char, QLatin1String> &types,
-             QMultiHash<char, QLatin1String> &keywords,
-             QMultiHash<char, QLatin1String> &builtin,
-             QMultiHash<char, QLatin1String> &literals,
-             QMultiHash<char, QLatin1String> &other){
-    types = php_types;
-    keywords = php_keywords;
-    builtin = php_builtin;
-    literals = php_literals;
-    other = php_other;
-}
+static constexpr KeywordTable::Word php_words[] = {
+    {"COOKIE", KeywordTable::Other},
+    {"ENV", KeywordTable::Other},
+    {"FILES", KeywordTable::Other},
+    {"GET", KeywordTable::Other},
+    {"GLOBALS", KeywordTable::Other},
+    {"HTTP_RAW_POST_DATA", KeywordTable::Other},
+    {"POST", KeywordTable::Other},
+    {"REQUEST", KeywordTable::Other},
+    {"SERVER", KeywordTable::Other},
+    {"SESSION", KeywordTable::Other},
+    {"__DIR__", KeywordTable::Other},
+    {"__FILE__", KeywordTable::Other},
+    {"__LINE__", KeywordTable::Other},
+    {"__CLASS__", KeywordTable::Other},
+    {"__METHOD__", KeywordTable::Other},
+    {"__FUNCTION__", KeywordTable::Other},
+    {"__NAMESPACE__", KeywordTable::Other},
+    {"as", KeywordTable::Keyword},
+    {"and", KeywordTable::Keyword},
+    {"argc", KeywordTable::Other},
+    {"argv", KeywordTable::Other},
+    {"array", KeywordTable::Type},
+    {"abstract", KeywordTable::Keyword},
+    {"break", KeywordTable::Keyword},
+    {"case", KeywordTable::Keyword},
+    {"catch", KeywordTable::Keyword},
+    {"class", KeywordTable::Type},
+    {"clone", KeywordTable::Keyword},
+    {"const", KeywordTable::Keyword},
+    {"continue", KeywordTable::Keyword},
+    {"do", KeywordTable::Keyword},
+    {"die", KeywordTable::Keyword},
+    {"declare", KeywordTable::Keyword},
+    {"default", KeywordTable::Keyword},
+    {"echo", KeywordTable::Keyword},
+    {"else", KeywordTable::Keyword},
+    {"enum", KeywordTable::Type},
+    {"eval", KeywordTable::Keyword},
+    {"exit", KeywordTable::Keyword},
+    {"empty", KeywordTable::Keyword},
+    {"endif", KeywordTable::Keyword},
+    {"elseif", KeywordTable::Keyword},
+    {"endfor", KeywordTable::Keyword},
+    {"endwhile", KeywordTable::Keyword},
+    {"endswitch", KeywordTable::Keyword},
+    {"exception", KeywordTable::Keyword},
+    {"enddeclare", KeywordTable::Keyword},
+    {"endforeach", KeywordTable::Keyword},
+    {"for", KeywordTable::Keyword},
+    {"false", KeywordTable::Literal},
+    {"final", KeywordTable::Keyword},
+    {"finally", KeywordTable::Keyword},
+    {"foreach", KeywordTable::Keyword},
+    {"goto", KeywordTable::Keyword},
+    {"global", KeywordTable::Keyword},
+    {"http_response_header", KeywordTable::Other},
+    {"if", KeywordTable::Keyword},
+    {"isset", KeywordTable::Keyword},
+    {"include", KeywordTable::Other},
+    {"insteadof", KeywordTable::Keyword},
+    {"interface", KeywordTable::Keyword},
+    {"instanceof", KeywordTable::Keyword},
+    {"include_once", KeywordTable::Other},
+    {"list", KeywordTable::Keyword},
+    {"new", KeywordTable::Keyword},
+    {"null", KeywordTable::Literal},
+    {"or", KeywordTable::Keyword},
+    {"print", KeywordTable::Keyword},
+    {"parent", KeywordTable::Keyword},
+    {"public", KeywordTable::Keyword},
+    {"private", KeywordTable::Keyword},
+    {"protected", KeywordTable::Keyword},
+    {"php_errormsg", KeywordTable::Other},
+    {"return", KeywordTable::Keyword},
+    {"require", KeywordTable::Other},
+    {"require_once", KeywordTable::Other},
+    {"self", KeywordTable::Keyword},
+    {"static", KeywordTable::Keyword},
+    {"switch", KeywordTable::Keyword},
+    {"try", KeywordTable::Keyword},
+    {"true", KeywordTable::Literal},
+    {"throw", KeywordTable::Keyword},
+    {"trait", KeywordTable::Keyword},
+    {"use", KeywordTable::Keyword},
+    {"unset", KeywordTable::Keyword},
+    {"var", KeywordTable::Type},
+    {"while", KeywordTable::Keyword},
+    {"xor", KeywordTable::Keyword},
+    {"yield", KeywordTable::Keyword}
+};
+static_assert(KeywordTable::isSorted(php_words), "php_words isn't sorted");
+static constexpr KeywordTable phpWords(php_words);
 
 /**********************************************************/
 /* QML Data *********************************************/
 /**********************************************************/
 
-static const QMultiHash<char, QLatin1String> qml_keywords = {
-    {('d'), QLatin1String("default")},
-    {('p'), QLatin1String("property")},
-    {('i'), QLatin1String("int")},
-    {('v'), QLatin1String("var")},
-    {('s'), QLatin1String("string")},
-    {('f'), QLatin1String("function")},
-    {('r'), QLatin1String("readonly")},
-    {('M'), QLatin1String("MouseArea")},
-    {('d'), QLatin1String("delegate")},
-    {('i'), QLatin1String("if")},
-    {('e'), QLatin1String("else")},
-
-    {('e'), QLatin1String("eval")},
-    {('i'), QLatin1String("isFinite")},
-    {('i'), QLatin1String("isNaN")},
-    {('p'), QLatin1String("parseFloat")},
-    {('p'), QLatin1String("parseInt")},
-    {('d'), QLatin1String("decodeURI")},
-    {('d'), QLatin1String("decodeURIComponent")},
-    {('e'), QLatin1String("encodeURI")},
-    {('e'), QLatin1String("encodeURIComponent")},
-    {('e'), QLatin1String("escape")},
-    {('u'), QLatin1String("unescape")},
-    {('O'), QLatin1String("Object")},
-    {('E'), QLatin1String("Error")},
-    {('E'), QLatin1String("EvalError")},
-    {('I'), QLatin1String("InternalError")},
-    {('R'), QLatin1String("RangeError")},
-    {('R'), QLatin1String("ReferenceError")},
-    {('S'), QLatin1String("StopIteration")},
-    {('S'), QLatin1String("SyntaxError")},
-    {('T'), QLatin1String("TypeError")},
-    {('U'), QLatin1String("URIError")},
-    {('N'), QLatin1String("Number")},
-    {('M'), QLatin1String("Math")},
-    {('D'), QLatin1String("Date")},
-    {('S'), QLatin1String("String")},
-    {('R'), QLatin1String("RegExp")},
-    {('A'), QLatin1String("Array")},
-    {('F'), QLatin1String("Float32Array")},
-    {('F'), QLatin1String("Float64Array")},
-    {('I'), QLatin1String("Int16Array")},
-    {('I'), QLatin1String("Int32Array")},
-    {('I'), QLatin1String("Int8Array")},
-    {('U'), QLatin1String("Uint16Array")},
-    {('U'), QLatin1String("Uint32Array")},
-    {('U'), QLatin1String("Uint8Array")},
-    {('U'), QLatin1String("Uint8ClampedArray")},
-    {('A'), QLatin1String("ArrayBuffer")},
-    {('D'), QLatin1String("DataView")},
-    {('J'), QLatin1String("JSON")},
-    {('I'), QLatin1String("Intl")},
-    {('a'), QLatin1String("arguments")},
-    {('m'), QLatin1String("module")},
-    {('c'), QLatin1String("console")},
-    {('w'), QLatin1String("window")},
-    {('d'), QLatin1String("document")},
-    {('S'), QLatin1String("Symbol")},
-    {('S'), QLatin1String("Set")},
-    {('M'), QLatin1String("Map")},
-    {('W'), QLatin1String("WeakSet")},
-    {('W'), QLatin1String("WeakMap")},
-    {('P'), QLatin1String("Proxy")},
-    {('R'), QLatin1String("Reflect")},
-    {('B'), QLatin1String("Behavior")},
-    {('c'), QLatin1String("color")},
-    {('c'), QLatin1String("coordinate")},
-    {('d'), QLatin1String("date")},
-    {('e'), QLatin1String("enumeration")},
-    {('f'), QLatin1String("font")},
-    {('g'), QLatin1String("geocircle")},
-    {('g'), QLatin1String("georectangle")},
-    {('g'), QLatin1String("geoshape")},
-    {('l'), QLatin1String("list")},
-    {('m'), QLatin1String("matrix4x4")},
-    {('p'), QLatin1String("parent")},
-    {('p'), QLatin1String("point")},
-    {('q'), QLatin1String("quaternion")},
-    {('r'), QLatin1String("real")},
-    {('s'), QLatin1String("size")},
-    {('s'), QLatin1String("string")},
-    {('v'), QLatin1String("variant")},
-    {('v'), QLatin1String("vector2d")},
-    {('v'), QLatin1String("vector3d")},
-    {('v'), QLatin1String("vector4d")},
-    {('P'), QLatin1String("Promise")}
-};
-
-static const QMultiHash<char, QLatin1String> qml_types = {
-    {('R'), QLatin1String("Rectangle")},
-    {('T'), QLatin1String("Text")},
-    {('c'), QLatin1String("color")},
-    {('I'), QLatin1String("Item")},
-    {('u'), QLatin1String("url")},
-    {('C'), QLatin1String("Component")},
-    {('B'), QLatin1String("Button")},
-    {('T'), QLatin1String("TextInput")},
-    {('L'), QLatin1String("ListView")},
-
-
-};
-
-static const QMultiHash<char, QLatin1String> qml_literals = {
-    {('f'), QLatin1String("false")},
-    {('t'), QLatin1String("true")}
-};
-
-static const QMultiHash<char, QLatin1String> qml_builtin = {
-
-};
-
-static const QMultiHash<char, QLatin1String> qml_other = {
-    {('i'), QLatin1String("import")}
-};
-
-void loadQMLData(QMultiHash<char, QLatin1String> &types,
-             QMultiHash<char, QLatin1String> &keywords,
-             QMultiHash<char, QLatin1String> &builtin,
-             QMultiHash<char, QLatin1String> &literals,
-             QMultiHash<char, QLatin1String> &other){
-    types = qml_types;
-    keywords = qml_keywords;
-    builtin = qml_builtin;
-    literals = qml_literals;
-    other = qml_other;
-}
+static constexpr KeywordTable::Word qml_words[] = {
+    {"Array", KeywordTable::Keyword},
+    {"ArrayBuffer", KeywordTable::Keyword},
+    {"Button", KeywordTable::Type},
+    {"Behavior", KeywordTable::Keyword},
+    {"Component", KeywordTable::Type},
+    {"Date", KeywordTable::Keyword},
+    {"DataView", KeywordTable::Keyword},
+    {"Error", KeywordTable::Keyword},
+    {"EvalError", KeywordTable::Keyword},
+    {"Float32Array", KeywordTable::Keyword},
+    {"Float64Array", KeywordTable::Keyword},
+    {"Intl", KeywordTable::Keyword},
+    {"Item", KeywordTable::Type},
+    {"Int8Array", KeywordTable::Keyword},
+    {"Int16Array", KeywordTable::Keyword},
+    {"Int32Array", KeywordTable::Keyword},
+    {"InternalError", KeywordTable::Keyword},
+    {"JSON", KeywordTable::Keyword},
+    {"ListView", KeywordTable::Type},
+    {"Map", KeywordTable::Keyword},
+    {"Math", KeywordTable::Keyword},
+    {"MouseArea", KeywordTable::Keyword},
+    {"Number", KeywordTable::Keyword},
+    {"Object", KeywordTable::Keyword},
+    {"Proxy", KeywordTable::Keyword},
+    {"Promise", KeywordTable::Keyword},
+    {"RegExp", KeywordTable::Keyword},
+    {"Reflect", KeywordTable::Keyword},
+    {"Rectangle", KeywordTable::Type},
+    {"RangeError", KeywordTable::Keyword},
+    {"ReferenceError", KeywordTable::Keyword},
+    {"Set", KeywordTable::Keyword},
+    {"String", KeywordTable::Keyword},
+    {"Symbol", KeywordTable::Keyword},
+    {"SyntaxError", KeywordTable::Keyword},
+    {"StopIteration", KeywordTable::Keyword},
+    {"Text", KeywordTable::Type},
+    {"TextInput", KeywordTable::Type},
+    {"TypeError", KeywordTable::Keyword},
+    {"URIError", KeywordTable::Keyword},
+    {"Uint8Array", KeywordTable::Keyword},
+    {"Uint16Array", KeywordTable::Keyword},
+    {"Uint32Array", KeywordTable::Keyword},
+    {"Uint8ClampedArray", KeywordTable::Keyword},
+    {"WeakMap", KeywordTable::Keyword},
+    {"WeakSet", KeywordTable::Keyword},
+    {"arguments", KeywordTable::Keyword},
+    {"color", KeywordTable::Type},
+    {"console", KeywordTable::Keyword},
+    {"coordinate", KeywordTable::Keyword},
+    {"date", KeywordTable::Keyword},
+    {"default", KeywordTable::Keyword},
+    {"delegate", KeywordTable::Keyword},
+    {"document", KeywordTable::Keyword},
+    {"decodeURI", KeywordTable::Keyword},
+    {"decodeURIComponent", KeywordTable::Keyword},
+    {"else", KeywordTable::Keyword},
+    {"eval", KeywordTable::Keyword},
+    {"escape", KeywordTable::Keyword},
+    {"encodeURI", KeywordTable::Keyword},
+    {"enumeration", KeywordTable::Keyword},
+    {"encodeURIComponent", KeywordTable::Keyword},
+    {"font", KeywordTable::Keyword},
+    {"false", KeywordTable::Literal},
+    {"function", KeywordTable::Keyword},
+    {"geoshape", KeywordTable::Keyword},
+    {"geocircle", KeywordTable::Keyword},
+    {"georectangle", KeywordTable::Keyword},
+    {"if", KeywordTable::Keyword},
+    {"int", KeywordTable::Keyword},
+    {"isNaN", KeywordTable::Keyword},
+    {"import", KeywordTable::Other},
+    {"isFinite", KeywordTable::Keyword},
+    {"list", KeywordTable::Keyword},
+    {"module", KeywordTable::Keyword},
+    {"matrix4x4", KeywordTable::Keyword},
+    {"point", KeywordTable::Keyword},
+    {"parent", KeywordTable::Keyword},
+    {"parseInt", KeywordTable::Keyword},
+    {"property", KeywordTable::Keyword},
+    {"parseFloat", KeywordTable::Keyword},
+    {"quaternion", KeywordTable::Keyword},
+    {"real", KeywordTable::Keyword},
+    {"readonly", KeywordTable::Keyword},
+    {"size", KeywordTable::Keyword},
+    {"string", KeywordTable::Keyword},
+    {"true", KeywordTable::Literal},
+    {"url", KeywordTable::Type},
+    {"unescape", KeywordTable::Keyword},
+    {"var", KeywordTable::Keyword},
+    {"variant", KeywordTable::Keyword},
+    {"vector2d", KeywordTable::Keyword},
+    {"vector3d", KeywordTable::Keyword},
+    {"vector4d", KeywordTable::Keyword},
+    {"window", KeywordTable::Keyword}
+};
+static_assert(KeywordTable::isSorted(qml_words), "qml_words isn't sorted");
+static constexpr KeywordTable qmlWords(qml_words);
 
 /**********************************************************/
 /* Python Data *********************************************/
 /**********************************************************/
 
-static const QMultiHash<char, QLatin1String> py_keywords = {
-    {('a'), QLatin1String("and")},
-    {('e'), QLatin1String("elif")},
-    {('i'), QLatin1String("is")},
-    {('g'), QLatin1String("global")},
-    {('a'), QLatin1String("as")},
-    {('i'), QLatin1String("in")},
-    {('i'), QLatin1String("if")},
-    {('f'), QLatin1String("from")},
-    {('r'), QLatin1String("raise")},
-    {('f'), QLatin1String("for")},
-    {('e'), QLatin1String("except")},
-    {('f'), QLatin1String("finally")},
-    {('p'), QLatin1String("print")},
-    {('p'), QLatin1String("pass")},
-    {('r'), QLatin1String("return")},
-    {('e'), QLatin1String("exec")},
-    {('e'), QLatin1String("else")},
-    {('b'), QLatin1String("break")},
-    {('n'), QLatin1String("not")},
-    {('w'), QLatin1String("with")},
-    {('c'), QLatin1String("class")},
-    {('a'), QLatin1String("assert")},
-    {('y'), QLatin1String("yield")},
-    {('t'), QLatin1String("try")},
-    {('w'), QLatin1String("while")},
-    {('c'), QLatin1String("continue")},
-    {('d'), QLatin1String("del")},
-    {('o'), QLatin1String("or")},
-    {('d'), QLatin1String("def")},
-    {('l'), QLatin1String("lambda")},
-    {('a'), QLatin1String("async")},
-    {('a'), QLatin1String("await")},
-    {('n'), QLatin1String("nonlocal")},
-};
-
-static const QMultiHash<char, QLatin1String> py_types = {
-
-};
-
-static const QMultiHash<char, QLatin1String> py_literals = {
-    {('F'), QLatin1String("False")},
-    {('T'), QLatin1String("True")},
-    {('N'), QLatin1String("None")}
-};
-
-static const QMultiHash<char, QLatin1String> py_builtin = {
-    {('_'), QLatin1String("__import__")},
-    {('a'), QLatin1String("abs")},
-    {('a'), QLatin1String("all")},
-    {('a'), QLatin1String("any")},
-    {('a'), QLatin1String("apply")},
-    {('a'), QLatin1String("ascii")},
-    {('b'), QLatin1String("basestring")},
-    {('b'), QLatin1String("bin")},
-    {('b'), QLatin1String("bool")},
-    {('b'), QLatin1String("buffer")},
-    {('b'), QLatin1String("bytearray")},
-    {('b'), QLatin1String("bytes")},
-    {('c'), QLatin1String("callable")},
-    {('c'), QLatin1String("chr")},
-    {('c'), QLatin1String("classmethod")},
-    {('c'), QLatin1String("cmp")},
-    {('c'), QLatin1String("coerce")},
-    {('c'), QLatin1String("compile")},
-    {('c'), QLatin1String("complex")},
-    {('d'), QLatin1String("delattr")},
-    {('d'), QLatin1String("dict")},
-    {('d'), QLatin1String("dir")},
-    {('d'), QLatin1String("divmod")},
-    {('e'), QLatin1String("enumerate")},
-    {('e'), QLatin1String("eval")},
-    {('e'), QLatin1String("execfile")},
-    {('f'), QLatin1String("file")},
-    {('f'), QLatin1String("filter")},
-    {('f'), QLatin1String("float")},
-    {('f'), QLatin1String("format")},
-    {('f'), QLatin1String("frozenset")},
-    {('g'), QLatin1String("getattr")},
-    {('g'), QLatin1String("globals")},
-    {('h'), QLatin1String("hasattr")},
-    {('h'), QLatin1String("hash")},
-    {('h'), QLatin1String("help")},
-    {('h'), QLatin1String("hex")},
-    {('i'), QLatin1String("id")},
-    {('i'), QLatin1String("input")},
-    {('i'), QLatin1String("int")},
-    {('i'), QLatin1String("intern")},
-    {('i'), QLatin1String("isinstance")},
-    {('i'), QLatin1String("issubclass")},
-    {('i'), QLatin1String("iter")},
-    {('l'), QLatin1String("len")},
-    {('l'), QLatin1String("list")},
-    {('l'), QLatin1String("locals")},
-    {('l'), QLatin1String("long")},
-    {('m'), QLatin1String("map")},
-    {('m'), QLatin1String("max")},
-    {('m'), QLatin1String("memoryview")},
-    {('m'), QLatin1String("min")},
-    {('n'), QLatin1String("next")},
-    {('o'), QLatin1String("object")},
-    {('o'), QLatin1String("oct")},
-    {('o'), QLatin1String("open")},
-    {('o'), QLatin1String("ord")},
-    {('p'), QLatin1String("pow")},
-    {('p'), QLatin1String("property")},
-    {('r'), QLatin1String("range")},
-    {('r'), QLatin1String("raw_input")},
-    {('r'), QLatin1String("reduce")},
-    {('r'), QLatin1String("reload")},
-    {('r'), QLatin1String("repr")},
-    {('r'), QLatin1String("reversed")},
-    {('r'), QLatin1String("round")},
-    {('s'), QLatin1String("set")},
-    {('s'), QLatin1String("setattr")},
-    {('s'), QLatin1String("slice")},
-    {('s'), QLatin1String("sorted")},
-    {('s'), QLatin1String("staticmethod")},
-    {('s'), QLatin1String("str")},
-    {('s'), QLatin1String("sum")},
-    {('s'), QLatin1String("super")},
-    {('t'), QLatin1String("tuple")},
-    {('t'), QLatin1String("type")},
-    {('u'), QLatin1String("unichr")},
-    {('u'), QLatin1String("unicode")},
-    {('v'), QLatin1String("vars")},
-    {('x'), QLatin1String("xrange")},
-    {('z'), QLatin1String("zip")}
-};
-
-static const QMultiHash<char, QLatin1String> py_other = {
-    {('i'), QLatin1String("import")}
-};
-
-void loadPythonData(QMultiHash<char, QLatin1String> &types,
-             QMultiHash<char, QLatin1String> &keywords,
-             QMultiHash<char, QLatin1String> &builtin,
-             QMultiHash<char, QLatin1String> &literals,
-             QMultiHash<char, QLatin1String> &other){
-    types = py_types;
-    keywords = py_keywords;
-    builtin = py_builtin;
-    literals = py_literals;
-    other = py_other;
-}
+static constexpr KeywordTable::Word python_words[] = {
+    {"False", KeywordTable::Literal},
+    {"None", KeywordTable::Literal},
+    {"True", KeywordTable::Literal},
+    {"__import__", KeywordTable::BuiltIn},
+    {"as", KeywordTable::Keyword},
+    {"abs", KeywordTable::BuiltIn},
+    {"all", KeywordTable::BuiltIn},
+    {"and", KeywordTable::Keyword},
+    {"any", KeywordTable::BuiltIn},
+    {"apply", KeywordTable::BuiltIn},
+    {"ascii", KeywordTable::BuiltIn},
+    {"async", KeywordTable::Keyword},
+    {"await", KeywordTable::Keyword},
+    {"assert", KeywordTable::Keyword},
+    {"bin", KeywordTable::BuiltIn},
+    {"bool", KeywordTable::BuiltIn},
+    {"break", KeywordTable::Keyword},
+    {"bytes", KeywordTable::BuiltIn},
+    {"buffer", KeywordTable::BuiltIn},
+    {"bytearray", KeywordTable::BuiltIn},
+    {"basestring", KeywordTable::BuiltIn},
+    {"chr", KeywordTable::BuiltIn},
+    {"cmp", KeywordTable::BuiltIn},
+    {"class", KeywordTable::Keyword},
+    {"coerce", KeywordTable::BuiltIn},
+    {"compile", KeywordTable::BuiltIn},
+    {"complex", KeywordTable::BuiltIn},
+    {"callable", KeywordTable::BuiltIn},
+    {"continue", KeywordTable::Keyword},
+    {"classmethod", KeywordTable::BuiltIn},
+    {"def", KeywordTable::Keyword},
+    {"del", KeywordTable::Keyword},
+    {"dir", KeywordTable::BuiltIn},
+    {"dict", KeywordTable::BuiltIn},
+    {"divmod", KeywordTable::BuiltIn},
+    {"delattr", KeywordTable::BuiltIn},
+    {"elif", KeywordTable::Keyword},
+    {"else", KeywordTable::Keyword},
+    {"eval", KeywordTable::BuiltIn},
+    {"exec", KeywordTable::Keyword},
+    {"except", KeywordTable::Keyword},
+    {"execfile", KeywordTable::BuiltIn},
+    {"enumerate", KeywordTable::BuiltIn},
+    {"for", KeywordTable::Keyword},
+    {"file", KeywordTable::BuiltIn},
+    {"from", KeywordTable::Keyword},
+    {"float", KeywordTable::BuiltIn},
+    {"filter", KeywordTable::BuiltIn},
+    {"format", KeywordTable::BuiltIn},
+    {"finally", KeywordTable::Keyword},
+    {"frozenset", KeywordTable::BuiltIn},
+    {"global", KeywordTable::Keyword},
+    {"getattr", KeywordTable::BuiltIn},
+    {"globals", KeywordTable::BuiltIn},
+    {"hex", KeywordTable::BuiltIn},
+    {"hash", KeywordTable::BuiltIn},
+    {"help", KeywordTable::BuiltIn},
+    {"hasattr", KeywordTable::BuiltIn},
+    {"id", KeywordTable::BuiltIn},
+    {"if", KeywordTable::Keyword},
+    {"in", KeywordTable::Keyword},
+    {"is", KeywordTable::Keyword},
+    {"int", KeywordTable::BuiltIn},
+    {"iter", KeywordTable::BuiltIn},
+    {"input", KeywordTable::BuiltIn},
+    {"import", KeywordTable::Other},
+    {"intern", KeywordTable::BuiltIn},
+    {"isinstance", KeywordTable::BuiltIn},
+    {"issubclass", KeywordTable::BuiltIn},
+    {"len", KeywordTable::BuiltIn},
+    {"list", KeywordTable::BuiltIn},
+    {"long", KeywordTable::BuiltIn},
+    {"lambda", KeywordTable::Keyword},
+    {"locals", KeywordTable::BuiltIn},
+    {"map", KeywordTable::BuiltIn},
+    {"max", KeywordTable::BuiltIn},
+    {"min", KeywordTable::BuiltIn},
+    {"memoryview", KeywordTable::BuiltIn},
+    {"not", KeywordTable::Keyword},
+    {"next", KeywordTable::BuiltIn},
+    {"nonlocal", KeywordTable::Keyword},
+    {"or", KeywordTable::Keyword},
+    {"oct", KeywordTable::BuiltIn},
+    {"ord", KeywordTable::BuiltIn},
+    {"open", KeywordTable::BuiltIn},
+    {"object", KeywordTable::BuiltIn},
+    {"pow", KeywordTable::BuiltIn},
+    {"pass", KeywordTable::Keyword},
+    {"print", KeywordTable::Keyword},
+    {"property", KeywordTable::BuiltIn},
+    {"repr", KeywordTable::BuiltIn},
+    {"raise", KeywordTable::Keyword},
+    {"range", KeywordTable::BuiltIn},
+    {"round", KeywordTable::BuiltIn},
+    {"reduce", KeywordTable::BuiltIn},
+    {"reload", KeywordTable::BuiltIn},
+    {"return", KeywordTable::Keyword},
+    {"reversed", KeywordTable::BuiltIn},
+    {"raw_input", KeywordTable::BuiltIn},
+    {"set", KeywordTable::BuiltIn},
+    {"str", KeywordTable::BuiltIn},
+    {"sum", KeywordTable::BuiltIn},
+    {"slice", KeywordTable::BuiltIn},
+    {"super", KeywordTable::BuiltIn},
+    {"sorted", KeywordTable::BuiltIn},
+    {"setattr", KeywordTable::BuiltIn},
+    {"staticmethod", KeywordTable::BuiltIn},
+    {"try", KeywordTable::Keyword},
+    {"type", KeywordTable::BuiltIn},
+    {"tuple", KeywordTable::BuiltIn},
+    {"unichr", KeywordTable::BuiltIn},
+    {"unicode", KeywordTable::BuiltIn},
+    {"vars", KeywordTable::BuiltIn},
+    {"with", KeywordTable::Keyword},
+    {"while", KeywordTable::Keyword},
+    {"xrange", KeywordTable::BuiltIn},
+    {"yield", KeywordTable::Keyword},
+    {"zip", KeywordTable::BuiltIn}
+};
+static_assert(KeywordTable::isSorted(python_words), "python_words isn't sorted");
+static constexpr KeywordTable pythonWords(python_words);
 
 /********************************************************/
 /***   Rust DATA      ***********************************/
 /********************************************************/
 
-static const QMultiHash<char, QLatin1String> rust_keywords = {
-    {('a'), QLatin1String("abstract")},
-    {('a'), QLatin1String("alignof")},
-    {('a'), QLatin1String("as")},
-    {('a'), QLatin1String("async")},
-    {('a'), QLatin1String("await")},
-    {('b'), QLatin1String("be")},
-    {('b'), QLatin1String("box")},
-    {('b'), QLatin1String("break")},
-    {('c'), QLatin1String("const")},
-    {('c'), QLatin1String("continue")},
-    {('c'), QLatin1String("crate")},
-    {('d'), QLatin1String("do")},
-    {('d'), QLatin1String("dyn")},
-    {('e'), QLatin1String("else")},
-    {('e'), QLatin1String("extern")},
-    {('f'), QLatin1String("final")},
-    {('f'), QLatin1String("fn")},
-    {('f'), QLatin1String("for")},
-    {('i'), QLatin1String("if")},
-    {('i'), QLatin1String("impl")},
-    {('i'), QLatin1String("in")},
-    {('l'), QLatin1String("let")},
-    {('l'), QLatin1String("loop")},
-    {('m'), QLatin1String("match")},
-    {('m'), QLatin1String("mod")},
-    {('m'), QLatin1String("move")},
-    {('m'), QLatin1String("mut")},
-    {('o'), QLatin1String("offsetof")},
-    {('o'), QLatin1String("once")},
-    {('o'), QLatin1String("override")},
-    {('p'), QLatin1String("priv")},
-    {('p'), QLatin1String("pub")},
-    {('p'), QLatin1String("pure")},
-    {('r'), QLatin1String("ref")},
-    {('r'), QLatin1String("return")},
-    {('s'), QLatin1String("sizeof")},
-    {('s'), QLatin1String("static")},
-    {('s'), QLatin1String("self")},
-    {('S'), QLatin1String("Self")},
-    {('s'), QLatin1String("super")},
-    {('t'), QLatin1String("trait")},
-    {('t'), QLatin1String("type")},
-    {('t'), QLatin1String("typeof")},
-    {('u'), QLatin1String("unsafe")},
-    {('u'), QLatin1String("unsized")},
-    {('u'), QLatin1String("use")},
-    {('v'), QLatin1String("virtual")},
-    {('w'), QLatin1String("where")},
-    {('w'), QLatin1String("while")},
-    {('y'), QLatin1String("yield")},
-};
-
-static const QMultiHash<char, QLatin1String> rust_types = {
-    {('u'), QLatin1String("union")},
-    {('e'), QLatin1String("enum")},
-    {('s'), QLatin1String("struct")},
-
-    {('i'), QLatin1String("i8")},
-    {('i'), QLatin1String("i16")},
-    {('i'), QLatin1String("i32")},
-    {('i'), QLatin1String("i64")},
-    {('i'), QLatin1String("i128")},
-    {('i'), QLatin1String("isize")},
-    {('u'), QLatin1String("u8")},
-    {('u'), QLatin1String("u16")},
-    {('u'), QLatin1String("u32")},
-    {('u'), QLatin1String("u64")},
-    {('u'), QLatin1String("u128")},
-    {('u'), QLatin1String("usize")},
-    {('f'), QLatin1String("f32")},
-    {('f'), QLatin1String("f64")},
-    {('s'), QLatin1String("str")},
-    {('c'), QLatin1String("char")},
-    {('b'), QLatin1String("bool")},
-    {('B'), QLatin1String("Box")},
-    {('O'), QLatin1String("Option")},
-    {('R'), QLatin1String("Result")},
-    {('S'), QLatin1String("String")},
-    {('V'), QLatin1String("Vec")}
-};
-
-static const QMultiHash<char, QLatin1String> rust_literals = {
-    {('f'), QLatin1String("false")},
-    {('t'), QLatin1String("true")}
-};
-
-static const QMultiHash<char, QLatin1String> rust_builtin = {
-
-};
-
-static const QMultiHash<char, QLatin1String> rust_other = {
-    {('a'), QLatin1String("assert!")},
-    {('a'), QLatin1String("assert_eq!")},
-    {('b'), QLatin1String("bitflags!")},
-    {('b'), QLatin1String("bytes!")},
-    {('c'), QLatin1String("cfg!")},
-    {('c'), QLatin1String("col!")},
-    {('c'), QLatin1String("concat!")},
-    {('c'), QLatin1String("concat_idents!")},
-    {('d'), QLatin1String("debug_assert!")},
-    {('d'), QLatin1String("debug_assert_eq!")},
-    {('e'), QLatin1String("env!")},
-    {('p'), QLatin1String("panic!")},
-    {('f'), QLatin1String("file!")},
-    {('f'), QLatin1String("format!")},
-    {('f'), QLatin1String("format_args!")},
-    {('i'), QLatin1String("include_bin!")},
-    {('i'), QLatin1String("include_str!")},
-    {('l'), QLatin1String("line!")},
-    {('l'), QLatin1String("local_data_key!")},
-    {('m'), QLatin1String("module_path!")},
-    {('o'), QLatin1String("option_env!")},
-    {('p'), QLatin1String("print!")},
-    {('p'), QLatin1String("println!")},
-    {('s'), QLatin1String("select!")},
-    {('s'), QLatin1String("stringify!")},
-    {('t'), QLatin1String("try!")},
-    {('u'), QLatin1String("unimplemented!")},
-    {('u'), QLatin1String("unreachable!")},
-    {('v'), QLatin1String("vec!")},
-    {('w'), QLatin1String("write!")},
-    {('w'), QLatin1String("writeln!")},
-    {('m'), QLatin1String("macro_rules!")},
-    {('a'), QLatin1String("assert_ne!")},
-    {('d'), QLatin1String("debug_assert_ne!")}
-};
-
-void loadRustData(QMultiHash<char, QLatin1String> &types,
-             QMultiHash<char, QLatin1String> &keywords,
-             QMultiHash<char, QLatin1String> &builtin,
-             QMultiHash<char, QLatin1String> &literals,
-             QMultiHash<char, QLatin1String> &other){
-    types = rust_types;
-    keywords = rust_keywords;
-    builtin = rust_builtin;
-    literals = rust_literals;
-    other = rust_other;
-}
+static constexpr KeywordTable::Word rust_words[] = {
+    {"Box", KeywordTable::Type},
+    {"Option", KeywordTable::Type},
+    {"Result", KeywordTable::Type},
+    {"Self", KeywordTable::Keyword},
+    {"String", KeywordTable::Type},
+    {"Vec", KeywordTable::Type},
+    {"as", KeywordTable::Keyword},
+    {"async", KeywordTable::Keyword},
+    {"await", KeywordTable::Keyword},
+    {"alignof", KeywordTable::Keyword},
+    {"assert!", KeywordTable::Other},
+    {"abstract", KeywordTable::Keyword},
+    {"assert_eq!", KeywordTable::Other},
+    {"assert_ne!", KeywordTable::Other},
+    {"be", KeywordTable::Keyword},
+    {"box", KeywordTable::Keyword},
+    {"bool", KeywordTable::Type},
+    {"break", KeywordTable::Keyword},
+    {"bytes!", KeywordTable::Other},
+    {"bitflags!", KeywordTable::Other},
+    {"cfg!", KeywordTable::Other},
+    {"char", KeywordTable::Type},
+    {"col!", KeywordTable::Other},
+    {"const", KeywordTable::Keyword},
+    {"crate", KeywordTable::Keyword},
+    {"concat!", KeywordTable::Other},
+    {"continue", KeywordTable::Keyword},
+    {"concat_idents!", KeywordTable::Other},
+    {"do", KeywordTable::Keyword},
+    {"dyn", KeywordTable::Keyword},
+    {"debug_assert!", KeywordTable::Other},
+    {"debug_assert_eq!", KeywordTable::Other},
+    {"debug_assert_ne!", KeywordTable::Other},
+    {"else", KeywordTable::Keyword},
+    {"enum", KeywordTable::Type},
+    {"env!", KeywordTable::Other},
+    {"extern", KeywordTable::Keyword},
+    {"fn", KeywordTable::Keyword},
+    {"f32", KeywordTable::Type},
+    {"f64", KeywordTable::Type},
+    {"for", KeywordTable::Keyword},
+    {"false", KeywordTable::Literal},
+    {"file!", KeywordTable::Other},
+    {"final", KeywordTable::Keyword},
+    {"format!", KeywordTable::Other},
+    {"format_args!", KeywordTable::Other},
+    {"i8", KeywordTable::Type},
+    {"if", KeywordTable::Keyword},
+    {"in", KeywordTable::Keyword},
+    {"i16", KeywordTable::Type},
+    {"i32", KeywordTable::Type},
+    {"i64", KeywordTable::Type},
+    {"i128", KeywordTable::Type},
+    {"impl", KeywordTable::Keyword},
+    {"isize", KeywordTable::Type},
+    {"include_bin!", KeywordTable::Other},
+    {"include_str!", KeywordTable::Other},
+    {"let", KeywordTable::Keyword},
+    {"loop", KeywordTable::Keyword},
+    {"line!", KeywordTable::Other},
+    {"local_data_key!", KeywordTable::Other},
+    {"mod", KeywordTable::Keyword},
+    {"mut", KeywordTable::Keyword},
+    {"move", KeywordTable::Keyword},
+    {"match", KeywordTable::Keyword},
+    {"macro_rules!", KeywordTable::Other},
+    {"module_path!", KeywordTable::Other},
+    {"once", KeywordTable::Keyword},
+    {"offsetof", KeywordTable::Keyword},
+    {"override", KeywordTable::Keyword},
+    {"option_env!", KeywordTable::Other},
+    {"pub", KeywordTable::Keyword},
+    {"priv", KeywordTable::Keyword},
+    {"pure", KeywordTable::Keyword},
+    {"panic!", KeywordTable::Other},
+    {"print!", KeywordTable::Other},
+    {"println!", KeywordTable::Other},
+    {"ref", KeywordTable::Keyword},
+    {"return", KeywordTable::Keyword},
+    {"str", KeywordTable::Type},
+    {"self", KeywordTable::Keyword},
+    {"super", KeywordTable::Keyword},
+    {"sizeof", KeywordTable::Keyword},
+    {"static", KeywordTable::Keyword},
+    {"struct", KeywordTable::Type},
+    {"select!", KeywordTable::Other},
+    {"stringify!", KeywordTable::Other},
+    {"true", KeywordTable::Literal},
+    {"try!", KeywordTable::Other},
+    {"type", KeywordTable::Keyword},
+    {"trait", KeywordTable::Keyword},
+    {"typeof", KeywordTable::Keyword},
+    {"u8", KeywordTable::Type},
+    {"u16", KeywordTable::Type},
+    {"u32", KeywordTable::Type},
+    {"u64", KeywordTable::Type},
+    {"use", KeywordTable::Keyword},
+    {"u128", KeywordTable::Type},
+    {"union", KeywordTable::Type},
+    {"usize", KeywordTable::Type},
+    {"unsafe", KeywordTable::Keyword},
+    {"unsized", KeywordTable::Keyword},
+    {"unreachable!", KeywordTable::Other},
+    {"unimplemented!", KeywordTable::Other},
+    {"vec!", KeywordTable::Other},
+    {"virtual", KeywordTable::Keyword},
+    {"where", KeywordTable::Keyword},
+    {"while", KeywordTable::Keyword},
+    {"write!", KeywordTable::Other},
+    {"writeln!", KeywordTable::Other},
+    {"yield", KeywordTable::Keyword}
+};
+static_assert(KeywordTable::isSorted(rust_words), "rust_words isn't sorted");
+static constexpr KeywordTable rustWords(rust_words);
 
 /********************************************************/
 /***   Java DATA      ***********************************/
 /********************************************************/
 
-static const QMultiHash<char, QLatin1String> java_keywords = {
-    {('a'), QLatin1String("abstract")},
-    {('a'), QLatin1String("assert")},
-    {('b'), QLatin1String("break")},
-    {('c'), QLatin1String("case")},
-    {('c'), QLatin1String("catch")},
-    {('c'), QLatin1String("const")},
-    {('c'), QLatin1String("continue")},
-    {('d'), QLatin1String("default")},
-    {('d'), QLatin1String("do")},
-    {('e'), QLatin1String("else")},
-    {('e'), QLatin1String("exports")},
-    {('e'), QLatin1String("extends")},
-    {('f'), QLatin1String("final")},
-    {('f'), QLatin1String("finally")},
-    {('f'), QLatin1String("for")},
-    {('g'), QLatin1String("goto")},
-    {('i'), QLatin1String("if")},
-    {('i'), QLatin1String("implements")},
-    {('i'), QLatin1String("import")},
-    {('i'), QLatin1String("instanceof")},
-    {('i'), QLatin1String("interface")},
-    {('l'), QLatin1String("long")},
-    {('m'), QLatin1String("module")},
-    {('n'), QLatin1String("native")},
-    {('n'), QLatin1String("new")},
-    {('n'), QLatin1String("null")},
-    {('o'), QLatin1String("open")},
-    {('o'), QLatin1String("opens")},
-    {('p'), QLatin1String("package")},
-    {('p'), QLatin1String("private")},
-    {('p'), QLatin1String("protected")},
-    {('p'), QLatin1String("provides")},
-    {('p'), QLatin1String("public")},
-    {('r'), QLatin1String("requires")},
-    {('r'), QLatin1String("return")},
-    {('s'), QLatin1String("static")},
-    {('s'), QLatin1String("strictfp")},
-    {('s'), QLatin1String("super")},
-    {('s'), QLatin1String("switch")},
-    {('s'), QLatin1String("synchronized")},
-    {('t'), QLatin1String("this")},
-    {('t'), QLatin1String("throw")},
-    {('t'), QLatin1String("throws")},
-    {('t'), QLatin1String("to")},
-    {('t'), QLatin1String("transient")},
-    {('t'), QLatin1String("transitive")},
-    {('t'), QLatin1String("try")},
-    {('u'), QLatin1String("uses")},
-    {('v'), QLatin1String("var")},
-    {('v'), QLatin1String("volatile")},
-    {('w'), QLatin1String("while")},
-    {('w'), QLatin1String("with")},
-    {('y'), QLatin1String("yield")}
-};
-
-static const QMultiHash<char, QLatin1String> java_types = {
-    {('v'), QLatin1String("void")},
-    {('f'), QLatin1String("float")},
-    {('b'), QLatin1String("boolean")},
-    {('b'), QLatin1String("byte")},
-    {('i'), QLatin1String("int")},
-    {('c'), QLatin1String("char")},
-    {('c'), QLatin1String("class")},
-    {('d'), QLatin1String("double")},
-    {('e'), QLatin1String("enum")},
-    {('s'), QLatin1String("short")},
-
-};
-
-static const QMultiHash<char, QLatin1String> java_literals = {
-    {('f'), QLatin1String("false")},
-    {('t'), QLatin1String("true")}
-};
-
-static const QMultiHash<char, QLatin1String> java_builtin = {
-
-};
-
-static const QMultiHash<char, QLatin1String> java_other = {
-
-};
-
-void loadJavaData(QMultiHash<char, QLatin1String> &types,
-             QMultiHash<char, QLatin1String> &keywords,
-             QMultiHash<char, QLatin1String> &builtin,
-             QMultiHash<char, QLatin1String> &literals,
-             QMultiHash<char, QLatin1String> &other){
-    types = java_types;
-    keywords = java_keywords;
-    builtin = java_builtin;
-    literals = java_literals;
-    other = java_other;
-}
+static constexpr KeywordTable::Word java_words[] = {
+    {"assert", KeywordTable::Keyword},
+    {"abstract", KeywordTable::Keyword},
+    {"byte", KeywordTable::Type},
+    {"break", KeywordTable::Keyword},
+    {"boolean", KeywordTable::Type},
+    {"case", KeywordTable::Keyword},
+    {"char", KeywordTable::Type},
+    {"catch", KeywordTable::Keyword},
+    {"class", KeywordTable::Type},
+    {"const", KeywordTable::Keyword},
+    {"continue", KeywordTable::Keyword},
+    {"do", KeywordTable::Keyword},
+    {"double", KeywordTable::Type},
+    {"default", KeywordTable::Keyword},
+    {"else", KeywordTable::Keyword},
+    {"enum", KeywordTable::Type},
+    {"exports", KeywordTable::Keyword},
+    {"extends", KeywordTable::Keyword},
+    {"for", KeywordTable::Keyword},
+    {"false", KeywordTable::Literal},
+    {"final", KeywordTable::Keyword},
+    {"float", KeywordTable::Type},
+    {"finally", KeywordTable::Keyword},
+    {"goto", KeywordTable::Keyword},
+    {"if", KeywordTable::Keyword},
+    {"int", KeywordTable::Type},
+    {"import", KeywordTable::Keyword},
+    {"interface", KeywordTable::Keyword},
+    {"implements", KeywordTable::Keyword},
+    {"instanceof", KeywordTable::Keyword},
+    {"long", KeywordTable::Keyword},
+    {"module", KeywordTable::Keyword},
+    {"new", KeywordTable::Keyword},
+    {"null", KeywordTable::Keyword},
+    {"native", KeywordTable::Keyword},
+    {"open", KeywordTable::Keyword},
+    {"opens", KeywordTable::Keyword},
+    {"public", KeywordTable::Keyword},
+    {"package", KeywordTable::Keyword},
+    {"private", KeywordTable::Keyword},
+    {"provides", KeywordTable::Keyword},
+    {"protected", KeywordTable::Keyword},
+    {"return", KeywordTable::Keyword},
+    {"requires", KeywordTable::Keyword},
+    {"short", KeywordTable::Type},
+    {"super", KeywordTable::Keyword},
+    {"static", KeywordTable::Keyword},
+    {"switch", KeywordTable::Keyword},
+    {"strictfp", KeywordTable::Keyword},
+    {"synchronized", KeywordTable::Keyword},
+    {"to", KeywordTable::Keyword},
+    {"try", KeywordTable::Keyword},
+    {"this", KeywordTable::Keyword},
+    {"true", KeywordTable::Literal},
+    {"throw", KeywordTable::Keyword},
+    {"throws", KeywordTable::Keyword},
+    {"transient", KeywordTable::Keyword},
+    {"transitive", KeywordTable::Keyword},
+    {"uses", KeywordTable::Keyword},
+    {"var", KeywordTable::Keyword},
+    {"void", KeywordTable::Type},
+    {"volatile", KeywordTable::Keyword},
+    {"with", KeywordTable::Keyword},
+    {"while", KeywordTable::Keyword},
+    {"yield", KeywordTable::Keyword}
+};
+static_assert(KeywordTable::isSorted(java_words), "java_words isn't sorted");
+static constexpr KeywordTable javaWords(java_words);
 
 /********************************************************/
 /***   C# DATA      *************************************/
 /********************************************************/
 
-static const QMultiHash<char, QLatin1String> csharp_keywords = {
-    {('a'), QLatin1String("abstract")},
-    {('a'), QLatin1String("add")},
-    {('a'), QLatin1String("alias")},
-    {('a'), QLatin1String("as")},
-    {('a'), QLatin1String("ascending")},
-    {('a'), QLatin1String("async")},
-    {('a'), QLatin1String("await")},
-    {('b'), QLatin1String("base")},
-    {('b'), QLatin1String("break")},
-    {('c'), QLatin1String("case")},
-    {('c'), QLatin1String("catch")},
-    {('c'), QLatin1String("checked")},
-    {('c'), QLatin1String("const")},
-    {('c'), QLatin1String("continue")},
-    {('d'), QLatin1String("decimal")},
-    {('d'), QLatin1String("default")},
-    {('d'), QLatin1String("delegate")},
-    {('d'), QLatin1String("descending")},
-    {('d'), QLatin1String("do")},
-    {('d'), QLatin1String("dynamic")},
-    {('e'), QLatin1String("else")},
-    {('e'), QLatin1String("event")},
-    {('e'), QLatin1String("explicit")},
-    {('e'), QLatin1String("extern")},
-    {('f'), QLatin1String("finally")},
-    {('f'), QLatin1String("fixed")},
-    {('f'), QLatin1String("for")},
-    {('f'), QLatin1String("foreach")},
-    {('f'), QLatin1String("from")},
-    {('g'), QLatin1String("get")},
-    {('g'), QLatin1String("global")},
-    {('g'), QLatin1String("goto")},
-    {('g'), QLatin1String("group")},
-    {('i'), QLatin1String("if")},
-    {('i'), QLatin1String("implicit")},
-    {('i'), QLatin1String("in")},
-    {('i'), QLatin1String("interface")},
-    {('i'), QLatin1String("internal")},
-    {('i'), QLatin1String("into")},
-    {('i'), QLatin1String("is")},
-    {('j'), QLatin1String("join")},
-    {('l'), QLatin1String("let")},
-    {('l'), QLatin1String("lock")},
-    {('l'), QLatin1String("long")},
-    {('n'), QLatin1String("namespace")},
-    {('n'), QLatin1String("new")},
-    {('o'), QLatin1String("object")},
-    {('o'), QLatin1String("operator")},
-    {('o'), QLatin1String("orderby")},
-    {('o'), QLatin1String("out")},
-    {('o'), QLatin1String("override")},
-    {('p'), QLatin1String("params")},
-    {('p'), QLatin1String("partial")},
-    {('p'), QLatin1String("private")},
-    {('p'), QLatin1String("protected")},
-    {('p'), QLatin1String("public")},
-    {('r'), QLatin1String("readonly")},
-    {('r'), QLatin1String("ref")},
-    {('r'), QLatin1String("remove")},
-    {('r'), QLatin1String("return")},
-    {('s'), QLatin1String("sealed")},
-    {('s'), QLatin1String("select")},
-    {('s'), QLatin1String("set")},
-    {('s'), QLatin1String("sizeof")},
-    {('s'), QLatin1String("stackalloc")},
-    {('s'), QLatin1String("static")},
-    {('s'), QLatin1String("switch")},
-    {('t'), QLatin1String("this")},
-    {('t'), QLatin1String("throw")},
-    {('t'), QLatin1String("try")},
-    {('t'), QLatin1String("typeof")},
-    {('u'), QLatin1String("unchecked")},
-    {('u'), QLatin1String("unsafe")},
-    {('u'), QLatin1String("using")},
-    {('v'), QLatin1String("value")},
-    {('v'), QLatin1String("virtual")},
-    {('v'), QLatin1String("volatile")},
-    {('w'), QLatin1String("where")},
-    {('w'), QLatin1String("while")},
-    {('y'), QLatin1String("yield")}
-};
-
-static const QMultiHash<char, QLatin1String> csharp_types = {
-    {('b'), QLatin1String("bool")},
-    {('b'), QLatin1String("byte")},
-    {('c'), QLatin1String("char")},
-    {('c'), QLatin1String("class")},
-    {('d'), QLatin1String("double")},
-    {('e'), QLatin1String("enum")},
-    {('f'), QLatin1String("float")},
-    {('i'), QLatin1String("int")},
-    {('s'), QLatin1String("sbyte")},
-    {('s'), QLatin1String("short")},
-    {('s'), QLatin1String("string")},
-    {('s'), QLatin1String("struct")},
-    {('u'), QLatin1String("uint")},
-    {('u'), QLatin1String("ulong")},
-    {('u'), QLatin1String("ushort")},
-    {('v'), QLatin1String("var")},
-    {('v'), QLatin1String("void")},
-};
-
-static const QMultiHash<char, QLatin1String> csharp_literals = {
-    {('f'), QLatin1String("false")},
-    {('t'), QLatin1String("true")},
-    {('n'), QLatin1String("null")}
-};
-
-static const QMultiHash<char, QLatin1String> csharp_builtin = {
-
-};
-
-static const QMultiHash<char, QLatin1String> csharp_other = {
-    {('d'), QLatin1String("define")},
-    {('e'), QLatin1String("elif")},
-    {('e'), QLatin1String("else")},
-    {('e'), QLatin1String("endif")},
-    {('e'), QLatin1String("endregion")},
-    {('e'), QLatin1String("error")},
-    {('i'), QLatin1String("if")},
-    {('l'), QLatin1String("line")},
-    {('p'), QLatin1String("pragma")},
-    {('r'), QLatin1String("region")},
-    {('u'), QLatin1String("undef")},
-    {('w'), QLatin1String("warning")}
-};
-
-void loadCSharpData(QMultiHash<char, QLatin1String> &types,
-             QMultiHash<char, QLatin1String> &keywords,
-             QMultiHash<char, QLatin1String> &builtin,
-             QMultiHash<char, QLatin1String> &literals,
-             QMultiHash<char, QLatin1String> &other){
-    types = csharp_types;
-    keywords = csharp_keywords;
-    builtin = csharp_builtin;
-    literals = csharp_literals;
-    other = csharp_other;
-}
+static constexpr KeywordTable::Word csharp_words[] = {
+    {"as", KeywordTable::Keyword},
+    {"add", KeywordTable::Keyword},
+    {"alias", KeywordTable::Keyword},
+    {"async", KeywordTable::Keyword},
+    {"await", KeywordTable::Keyword},
+    {"abstract", KeywordTable::Keyword},
+    {"ascending", KeywordTable::Keyword},
+    {"base", KeywordTable::Keyword},
+    {"bool", KeywordTable::Type},
+    {"byte", KeywordTable::Type},
+    {"break", KeywordTable::Keyword},
+    {"case", KeywordTable::Keyword},
+    {"char", KeywordTable::Type},
+    {"catch", KeywordTable::Keyword},
+    {"class", KeywordTable::Type},
+    {"const", KeywordTable::Keyword},
+    {"checked", KeywordTable::Keyword},
+    {"continue", KeywordTable::Keyword},
+    {"do", KeywordTable::Keyword},
+    {"define", KeywordTable::Other},
+    {"double", KeywordTable::Type},
+    {"decimal", KeywordTable::Keyword},
+    {"default", KeywordTable::Keyword},
+    {"dynamic", KeywordTable::Keyword},
+    {"delegate", KeywordTable::Keyword},
+    {"descending", KeywordTable::Keyword},
+    {"elif", KeywordTable::Other},
+    {"else", KeywordTable::Keyword},
+    {"enum", KeywordTable::Type},
+    {"endif", KeywordTable::Other},
+    {"error", KeywordTable::Other},
+    {"event", KeywordTable::Keyword},
+    {"extern", KeywordTable::Keyword},
+    {"explicit", KeywordTable::Keyword},
+    {"endregion", KeywordTable::Other},
+    {"for", KeywordTable::Keyword},
+    {"from", KeywordTable::Keyword},
+    {"false", KeywordTable::Literal},
+    {"fixed", KeywordTable::Keyword},
+    {"float", KeywordTable::Type},
+    {"finally", KeywordTable::Keyword},
+    {"foreach", KeywordTable::Keyword},
+    {"get", KeywordTable::Keyword},
+    {"goto", KeywordTable::Keyword},
+    {"group", KeywordTable::Keyword},
+    {"global", KeywordTable::Keyword},
+    {"if", KeywordTable::Keyword},
+    {"in", KeywordTable::Keyword},
+    {"is", KeywordTable::Keyword},
+    {"int", KeywordTable::Type},
+    {"into", KeywordTable::Keyword},
+    {"implicit", KeywordTable::Keyword},
+    {"internal", KeywordTable::Keyword},
+    {"interface", KeywordTable::Keyword},
+    {"join", KeywordTable::Keyword},
+    {"let", KeywordTable::Keyword},
+    {"line", KeywordTable::Other},
+    {"lock", KeywordTable::Keyword},
+    {"long", KeywordTable::Keyword},
+    {"new", KeywordTable::Keyword},
+    {"null", KeywordTable::Literal},
+    {"namespace", KeywordTable::Keyword},
+    {"out", KeywordTable::Keyword},
+    {"object", KeywordTable::Keyword},
+    {"orderby", KeywordTable::Keyword},
+    {"operator", KeywordTable::Keyword},
+    {"override", KeywordTable::Keyword},
+    {"params", KeywordTable::Keyword},
+    {"pragma", KeywordTable::Other},
+    {"public", KeywordTable::Keyword},
+    {"partial", KeywordTable::Keyword},
+    {"private", KeywordTable::Keyword},
+    {"protected", KeywordTable::Keyword},
+    {"ref", KeywordTable::Keyword},
+    {"region", KeywordTable::Other},
+    {"remove", KeywordTable::Keyword},
+    {"return", KeywordTable::Keyword},
+    {"readonly", KeywordTable::Keyword},
+    {"set", KeywordTable::Keyword},
+    {"sbyte", KeywordTable::Type},
+    {"short", KeywordTable::Type},
+    {"sealed", KeywordTable::Keyword},
+    {"select", KeywordTable::Keyword},
+    {"sizeof", KeywordTable::Keyword},
+    {"static", KeywordTable::Keyword},
+    {"string", KeywordTable::Type},
+    {"struct", KeywordTable::Type},
+    {"switch", KeywordTable::Keyword},
+    {"stackalloc", KeywordTable::Keyword},
+    {"try", KeywordTable::Keyword},
+    {"this", KeywordTable::Keyword},
+    {"true", KeywordTable::Literal},
+    {"throw", KeywordTable::Keyword},
+    {"typeof", KeywordTable::Keyword},
+    {"uint", KeywordTable::Type},
+    {"ulong", KeywordTable::Type},
+    {"undef", KeywordTable::Other},
+    {"using", KeywordTable::Keyword},
+    {"unsafe", KeywordTable::Keyword},
+    {"ushort", KeywordTable::Type},
+    {"unchecked", KeywordTable::Keyword},
+    {"var", KeywordTable::Type},
+    {"void", KeywordTable::Type},
+    {"value", KeywordTable::Keyword},
+    {"virtual", KeywordTable::Keyword},
+    {"volatile", KeywordTable::Keyword},
+    {"where", KeywordTable::Keyword},
+    {"while", KeywordTable::Keyword},
+    {"warning", KeywordTable::Other},
+    {"yield", KeywordTable::Keyword}
+};
+static_assert(KeywordTable::isSorted(csharp_words), "csharp_words isn't sorted");
+static constexpr KeywordTable csharpWords(csharp_words);
 
 /********************************************************/
 /***   Go DATA      *************************************/
 /********************************************************/
 
-static const QMultiHash<char, QLatin1String> go_keywords = {
-    {('b'), QLatin1String("break")},
-    {('c'), QLatin1String("case")},
-    {('c'), QLatin1String("chan")},
-    {('c'), QLatin1String("const")},
-    {('c'), QLatin1String("continue")},
-    {('d'), QLatin1String("default")},
-    {('d'), QLatin1String("defer")},
-    {('e'), QLatin1String("else")},
-    {('f'), QLatin1String("fallthrough")},
-    {('f'), QLatin1String("for")},
-    {('f'), QLatin1String("func")},
-    {('g'), QLatin1String("go")},
-    {('t'), QLatin1String("to")},
-    {('i'), QLatin1String("if")},
-    {('i'), QLatin1String("import")},
-    {('i'), QLatin1String("interface")},
-    {('p'), QLatin1String("package")},
-    {('r'), QLatin1String("range")},
-    {('r'), QLatin1String("return")},
-    {('s'), QLatin1String("select")},
-    {('s'), QLatin1String("struct")},
-    {('s'), QLatin1String("switch")},
-    {('t'), QLatin1String("type")},
-};
-
-static const QMultiHash<char, QLatin1String> go_types = {
-    {('m'), QLatin1String("map")},
-    {('s'), QLatin1String("struct")},
-    {('v'), QLatin1String("var")},
-    {('b'), QLatin1String("bool")},
-    {('b'), QLatin1String("byte")},
-    {('c'), QLatin1String("complex64")},
-    {('c'), QLatin1String("complex128")},
-    {('f'), QLatin1String("float32")},
-    {('f'), QLatin1String("float64")},
-    {('i'), QLatin1String("int8")},
-    {('i'), QLatin1String("int16")},
-    {('i'), QLatin1String("int32")},
-    {('i'), QLatin1String("int64")},
-    {('s'), QLatin1String("string")},
-    {('u'), QLatin1String("uint8")},
-    {('u'), QLatin1String("uint16")},
-    {('u'), QLatin1String("uint32")},
-    {('u'), QLatin1String("uint64")},
-    {('i'), QLatin1String("int")},
-    {('u'), QLatin1String("uint")},
-    {('u'), QLatin1String("uintptr")},
-    {('r'), QLatin1String("rune")}
-};
-
-static const QMultiHash<char, QLatin1String> go_literals = {
-    {('f'), QLatin1String("false")},
-    {('t'), QLatin1String("true")},
-    {('n'), QLatin1String("nil")},
-    {('i'), QLatin1String("iota")}
-};
-
-static const QMultiHash<char, QLatin1String> go_builtin = {
-    {('a'), QLatin1String("append")},
-    {('c'), QLatin1String("cap")},
-    {('c'), QLatin1String("close")},
-    {('c'), QLatin1String("complex")},
-    {('c'), QLatin1String("copy")},
-    {('i'), QLatin1String("imag")},
-    {('l'), QLatin1String("len")},
-    {('m'), QLatin1String("make")},
-    {('n'), QLatin1String("new")},
-    {('p'), QLatin1String("panic")},
-    {('p'), QLatin1String("print")},
-    {('p'), QLatin1String("println")},
-    {('r'), QLatin1String("real")},
-    {('r'), QLatin1String("recover")},
-    {('d'), QLatin1String("delete")}
-};
-
-static const QMultiHash<char, QLatin1String> go_other = {
-
-};
-
-
-void loadGoData(QMultiHash<char, QLatin1String> &types,
-             QMultiHash<char, QLatin1String> &keywords,
-             QMultiHash<char, QLatin1String> &builtin,
-             QMultiHash<char, QLatin1String> &literals,
-             QMultiHash<char, QLatin1String> &other) {
-    types = go_types;
-    keywords = go_keywords;
-    builtin = go_builtin;
-    literals = go_literals;
-    other = go_other;
-}
+static constexpr KeywordTable::Word go_words[] = {
+    {"append", KeywordTable::BuiltIn},
+    {"bool", KeywordTable::Type},
+    {"byte", KeywordTable::Type},
+    {"break", KeywordTable::Keyword},
+    {"cap", KeywordTable::BuiltIn},
+    {"case", KeywordTable::Keyword},
+    {"chan", KeywordTable::Keyword},
+    {"copy", KeywordTable::BuiltIn},
+    {"close", KeywordTable::BuiltIn},
+    {"const", KeywordTable::Keyword},
+    {"complex", KeywordTable::BuiltIn},
+    {"continue", KeywordTable::Keyword},
+    {"complex64", KeywordTable::Type},
+    {"complex128", KeywordTable::Type},
+    {"defer", KeywordTable::Keyword},
+    {"delete", KeywordTable::BuiltIn},
+    {"default", KeywordTable::Keyword},
+    {"else", KeywordTable::Keyword},
+    {"for", KeywordTable::Keyword},
+    {"func", KeywordTable::Keyword},
+    {"false", KeywordTable::Literal},
+    {"float32", KeywordTable::Type},
+    {"float64", KeywordTable::Type},
+    {"fallthrough", KeywordTable::Keyword},
+    {"go", KeywordTable::Keyword},
+    {"if", KeywordTable::Keyword},
+    {"int", KeywordTable::Type},
+    {"imag", KeywordTable::BuiltIn},
+    {"int8", KeywordTable::Type},
+    {"iota", KeywordTable::Literal},
+    {"int16", KeywordTable::Type},
+    {"int32", KeywordTable::Type},
+    {"int64", KeywordTable::Type},
+    {"import", KeywordTable::Keyword},
+    {"interface", KeywordTable::Keyword},
+    {"len", KeywordTable::BuiltIn},
+    {"map", KeywordTable::Type},
+    {"make", KeywordTable::BuiltIn},
+    {"new", KeywordTable::BuiltIn},
+    {"nil", KeywordTable::Literal},
+    {"panic", KeywordTable::BuiltIn},
+    {"print", KeywordTable::BuiltIn},
+    {"package", KeywordTable::Keyword},
+    {"println", KeywordTable::BuiltIn},
+    {"real", KeywordTable::BuiltIn},
+    {"rune", KeywordTable::Type},
+    {"range", KeywordTable::Keyword},
+    {"return", KeywordTable::Keyword},
+    {"recover", KeywordTable::BuiltIn},
+    {"select", KeywordTable::Keyword},
+    {"string", KeywordTable::Type},
+    {"struct", KeywordTable::Type},
+    {"switch", KeywordTable::Keyword},
+    {"to", KeywordTable::Keyword},
+    {"true", KeywordTable::Literal},
+    {"type", KeywordTable::Keyword},
+    {"uint", KeywordTable::Type},
+    {"uint8", KeywordTable::Type},
+    {"uint16", KeywordTable::Type},
+    {"uint32", KeywordTable::Type},
+    {"uint64", KeywordTable::Type},
+    {"uintptr", KeywordTable::Type},
+    {"var", KeywordTable::Type}
+};
+static_assert(KeywordTable::isSorted(go_words), "go_words isn't sorted");
+static constexpr KeywordTable goWords(go_words);
 
 /********************************************************/
 /***   V DATA      **************************************/
 /********************************************************/
 
-static const QMultiHash<char, QLatin1String> v_keywords = {
-    {('b'), QLatin1String("break")},
-    {('c'), QLatin1String("const")},
-    {('c'), QLatin1String("continue")},
-    {('d'), QLatin1String("defer")},
-    {('e'), QLatin1String("else")},
-    {('f'), QLatin1String("for")},
-    {('f'), QLatin1String("fn")},
-    {('g'), QLatin1String("go")},
-    {('g'), QLatin1String("goto")},
-    {('i'), QLatin1String("if")},
-    {('i'), QLatin1String("import")},
-    {('i'), QLatin1String("interface")},
-    {('r'), QLatin1String("return")},
-    {('s'), QLatin1String("struct")},
-    {('s'), QLatin1String("switch")},
-    {('t'), QLatin1String("type")},
-    {('p'), QLatin1String("pub")},
-    {('o'), QLatin1String("or")},
-    {('n'), QLatin1String("none")}
-};
-
-static const QMultiHash<char, QLatin1String> v_types = {
-    {('m'), QLatin1String("map")},
-    {('s'), QLatin1String("struct")},
-    {('b'), QLatin1String("bool")},
-    {('b'), QLatin1String("byte")},
-    {('f'), QLatin1String("f32")},
-    {('f'), QLatin1String("f64")},
-    {('i'), QLatin1String("i8")},
-    {('i'), QLatin1String("i16")},
-    {('i'), QLatin1String("int")},
-    {('i'), QLatin1String("i64")},
-    {('i'), QLatin1String("i128")},
-    {('s'), QLatin1String("string")},
-    {('u'), QLatin1String("u16")},
-    {('u'), QLatin1String("u32")},
-    {('u'), QLatin1String("u64")},
-    {('u'), QLatin1String("u128")},
-    {('u'), QLatin1String("byteptr")},
-    {('u'), QLatin1String("voidptr")},
-    {('r'), QLatin1String("rune")}
-};
-
-static const QMultiHash<char, QLatin1String> v_literals = {
-    {('f'), QLatin1String("false")},
-    {('t'), QLatin1String("true")},
-};
-
-static const QMultiHash<char, QLatin1String> v_builtin = {
-};
-
-static const QMultiHash<char, QLatin1String> v_other = {
-
-};
-
-void loadVData(QMultiHash<char, QLatin1String> &types,
-             QMultiHash<char, QLatin1String> &keywords,
-             QMultiHash<char, QLatin1String> &builtin,
-             QMultiHash<char, QLatin1String> &literals,
-             QMultiHash<char, QLatin1String> &other) {
-    types = v_types;
-    keywords = v_keywords;
-    builtin = v_builtin;
-    literals = v_literals;
-    other = v_other;
-}
+static constexpr KeywordTable::Word v_words[] = {
+    {"bool", KeywordTable::Type},
+    {"byte", KeywordTable::Type},
+    {"break", KeywordTable::Keyword},
+    {"byteptr", KeywordTable::Type},
+    {"const", KeywordTable::Keyword},
+    {"continue", KeywordTable::Keyword},
+    {"defer", KeywordTable::Keyword},
+    {"else", KeywordTable::Keyword},
+    {"fn", KeywordTable::Keyword},
+    {"f32", KeywordTable::Type},
+    {"f64", KeywordTable::Type},
+    {"for", KeywordTable::Keyword},
+    {"false", KeywordTable::Literal},
+    {"go", KeywordTable::Keyword},
+    {"goto", KeywordTable::Keyword},
+    {"i8", KeywordTable::Type},
+    {"if", KeywordTable::Keyword},
+    {"i16", KeywordTable::Type},
+    {"i64", KeywordTable::Type},
+    {"int", KeywordTable::Type},
+    {"i128", KeywordTable::Type},
+    {"import", KeywordTable::Keyword},
+    {"interface", KeywordTable::Keyword},
+    {"map", KeywordTable::Type},
+    {"none", KeywordTable::Keyword},
+    {"or", KeywordTable::Keyword},
+    {"pub", KeywordTable::Keyword},
+    {"rune", KeywordTable::Type},
+    {"return", KeywordTable::Keyword},
+    {"string", KeywordTable::Type},
+    {"struct", KeywordTable::Type},
+    {"switch", KeywordTable::Keyword},
+    {"true", KeywordTable::Literal},
+    {"type", KeywordTable::Keyword},
+    {"u16", KeywordTable::Type},
+    {"u32", KeywordTable::Type},
+    {"u64", KeywordTable::Type},
+    {"u128", KeywordTable::Type},
+    {"voidptr", KeywordTable::Type}
+};
+static_assert(KeywordTable::isSorted(v_words), "v_words isn't sorted");
+static constexpr KeywordTable vWords(v_words);
 
 /********************************************************/
 /***   SQL DATA      ************************************/
 /********************************************************/
 
-
-static const QMultiHash<char, QLatin1String> sql_keywords = {
-    {('A'), QLatin1String("ACTION")},
-    {('A'), QLatin1String("ADD")},
-    {('A'), QLatin1String("AFTER")},
-    {('A'), QLatin1String("ALGORITHM")},
-    {('A'), QLatin1String("ALL")},
-    {('A'), QLatin1String("ALTER")},
-    {('A'), QLatin1String("ANALYZE")},
-    {('A'), QLatin1String("ANY")},
-    {('A'), QLatin1String("APPLY")},
-    {('A'), QLatin1String("AS")},
-    {('A'), QLatin1String("ASC")},
-    {('A'), QLatin1String("AUTHORIZATION")},
-    {('A'), QLatin1String("AUTO_INCREMENT")},
-    {('B'), QLatin1String("BACKUP")},
-    {('B'), QLatin1String("BDB")},
-    {('B'), QLatin1String("BEGIN")},
-    {('B'), QLatin1String("BERKELEYDB")},
-    {('B'), QLatin1String("BIGINT")},
-    {('B'), QLatin1String("BINARY")},
-    {('B'), QLatin1String("BIT")},
-    {('B'), QLatin1String("BLOB")},
-    {('B'), QLatin1String("BOOL")},
-    {('B'), QLatin1String("BOOLEAN")},
-    {('B'), QLatin1String("BREAK")},
-    {('B'), QLatin1String("BROWSE")},
-    {('B'), QLatin1String("BTREE")},
-    {('B'), QLatin1String("BULK")},
-    {('B'), QLatin1String("BY")},
-    {('C'), QLatin1String("CALL")},
-    {('C'), QLatin1String("CASCADED")},
-    {('C'), QLatin1String("CASE")},
-    {('C'), QLatin1String("CHAIN")},
-    {('C'), QLatin1String("CHARACTER")},
-    {('S'), QLatin1String("SET")},
-    {('C'), QLatin1String("CHECKPOINT")},
-    {('C'), QLatin1String("CLOSE")},
-    {('C'), QLatin1String("CLUSTERED")},
-    {('C'), QLatin1String("COALESCE")},
-    {('C'), QLatin1String("COLLATE")},
-    {('C'), QLatin1String("COLUMNS")},
-    {('C'), QLatin1String("COMMENT")},
-    {('C'), QLatin1String("COMMITTED")},
-    {('C'), QLatin1String("COMPUTE")},
-    {('C'), QLatin1String("CONNECT")},
-    {('C'), QLatin1String("CONSISTENT")},
-    {('C'), QLatin1String("CONSTRAINT")},
-    {('C'), QLatin1String("CONTAINSTABLE")},
-    {('C'), QLatin1String("CONTINUE")},
-    {('C'), QLatin1String("CONVERT")},
-    {('C'), QLatin1String("CREATE")},
-    {('C'), QLatin1String("CROSS")},
-    {('C'), QLatin1String("CURRENT_DATE")},
-    {('_'), QLatin1String("_TIME")},
-    {('_'), QLatin1String("_TIMESTAMP")},
-    {('_'), QLatin1String("_USER")},
-    {('C'), QLatin1String("CURSOR")},
-    {('C'), QLatin1String("CYCLE")},
-    {('D'), QLatin1String("DATABASES")},
-    {('D'), QLatin1String("DATETIME")},
-    {('D'), QLatin1String("DAY")},
-    {('D'), QLatin1String("DBCC")},
-    {('D'), QLatin1String("DEALLOCATE")},
-    {('D'), QLatin1String("DEC")},
-    {('D'), QLatin1String("DECIMAL")},
-    {('D'), QLatin1String("DECLARE")},
-    {('D'), QLatin1String("DEFAULT")},
-    {('D'), QLatin1String("DEFINER")},
-    {('D'), QLatin1String("DELAYED")},
-    {('D'), QLatin1String("DELETE")},
-    {('D'), QLatin1String("DELIMITERS")},
-    {('D'), QLatin1String("DENY")},
-    {('D'), QLatin1String("DESC")},
-    {('D'), QLatin1String("DESCRIBE")},
-    {('D'), QLatin1String("DETERMINISTIC")},
-    {('D'), QLatin1String("DISABLE")},
-    {('D'), QLatin1String("DISCARD")},
-    {('D'), QLatin1String("DISK")},
-    {('D'), QLatin1String("DISTINCT")},
-    {('D'), QLatin1String("DISTINCTROW")},
-    {('D'), QLatin1String("DISTRIBUTED")},
-    {('D'), QLatin1String("DO")},
-    {('D'), QLatin1String("DOUBLE")},
-    {('D'), QLatin1String("DROP")},
-    {('D'), QLatin1String("DUMMY")},
-    {('D'), QLatin1String("DUMPFILE")},
-    {('D'), QLatin1String("DUPLICATE")},
-    {('E'), QLatin1String("ELSEIF")},
-    {('E'), QLatin1String("ENABLE")},
-    {('E'), QLatin1String("ENCLOSED")},
-    {('E'), QLatin1String("END")},
-    {('E'), QLatin1String("ENGINE")},
-    {('E'), QLatin1String("ENUM")},
-    {('E'), QLatin1String("ERRLVL")},
-    {('E'), QLatin1String("ERRORS")},
-    {('E'), QLatin1String("ESCAPED")},
-    {('E'), QLatin1String("EXCEPT")},
-    {('E'), QLatin1String("EXECUTE")},
-    {('E'), QLatin1String("EXISTS")},
-    {('E'), QLatin1String("EXIT")},
-    {('E'), QLatin1String("EXPLAIN")},
-    {('E'), QLatin1String("EXTENDED")},
-    {('F'), QLatin1String("FETCH")},
-    {('F'), QLatin1String("FIELDS")},
-    {('F'), QLatin1String("FILE")},
-    {('F'), QLatin1String("FILLFACTOR")},
-    {('F'), QLatin1String("FIRST")},
-    {('F'), QLatin1String("FIXED")},
-    {('F'), QLatin1String("FLOAT")},
-    {('F'), QLatin1String("FOLLOWING")},
-    {('F'), QLatin1String("FOR")},
-    {('E'), QLatin1String("EACH")},
-    {('R'), QLatin1String("ROW")},
-    {('F'), QLatin1String("FORCE")},
-    {('F'), QLatin1String("FOREIGN")},
-    {('F'), QLatin1String("FREETEXTTABLE")},
-    {('F'), QLatin1String("FROM")},
-    {('F'), QLatin1String("FULL")},
-    {('F'), QLatin1String("FUNCTION")},
-    {('G'), QLatin1String("GEOMETRYCOLLECTION")},
-    {('G'), QLatin1String("GLOBAL")},
-    {('G'), QLatin1String("GOTO")},
-    {('G'), QLatin1String("GRANT")},
-    {('G'), QLatin1String("GROUP")},
-    {('H'), QLatin1String("HANDLER")},
-    {('H'), QLatin1String("HASH")},
-    {('H'), QLatin1String("HAVING")},
-    {('H'), QLatin1String("HOLDLOCK")},
-    {('H'), QLatin1String("HOUR")},
-    {('I'), QLatin1String("IDENTITY_INSERT")},
-    {('C'), QLatin1String("COL")},
-    {('I'), QLatin1String("IF")},
-    {('I'), QLatin1String("IGNORE")},
-    {('I'), QLatin1String("IMPORT")},
-    {('I'), QLatin1String("INDEX")},
-    {('I'), QLatin1String("INFILE")},
-    {('I'), QLatin1String("INNER")},
-    {('I'), QLatin1String("INNODB")},
-    {('I'), QLatin1String("INOUT")},
-    {('I'), QLatin1String("INSERT")},
-    {('I'), QLatin1String("INT")},
-    {('I'), QLatin1String("INTEGER")},
-    {('I'), QLatin1String("INTERSECT")},
-    {('I'), QLatin1String("INTERVAL")},
-    {('I'), QLatin1String("INTO")},
-    {('I'), QLatin1String("INVOKER")},
-    {('I'), QLatin1String("ISOLATION")},
-    {('I'), QLatin1String("ITERATE")},
-    {('J'), QLatin1String("JOIN")},
-    {('K'), QLatin1String("KEYS")},
-    {('K'), QLatin1String("KILL")},
-    {('L'), QLatin1String("LANGUAGE")},
-    {('L'), QLatin1String("LAST")},
-    {('L'), QLatin1String("LEAVE")},
-    {('L'), QLatin1String("LEFT")},
-    {('L'), QLatin1String("LEVEL")},
-    {('L'), QLatin1String("LIMIT")},
-    {('L'), QLatin1String("LINENO")},
-    {('L'), QLatin1String("LINES")},
-    {('L'), QLatin1String("LINESTRING")},
-    {('L'), QLatin1String("LOAD")},
-    {('L'), QLatin1String("LOCAL")},
-    {('L'), QLatin1String("LOCK")},
-    {('L'), QLatin1String("LONGBLOB")},
-    {('T'), QLatin1String("TEXT")},
-    {('L'), QLatin1String("LOOP")},
-    {('M'), QLatin1String("MATCHED")},
-    {('M'), QLatin1String("MEDIUMBLOB")},
-    {('I'), QLatin1String("INT")},
-    {('T'), QLatin1String("TEXT")},
-    {('M'), QLatin1String("MERGE")},
-    {('M'), QLatin1String("MIDDLEINT")},
-    {('M'), QLatin1String("MINUTE")},
-    {('M'), QLatin1String("MODE")},
-    {('M'), QLatin1String("MODIFIES")},
-    {('M'), QLatin1String("MODIFY")},
-    {('M'), QLatin1String("MONTH")},
-    {('M'), QLatin1String("MULTILINESTRING")},
-    {('P'), QLatin1String("POINT")},
-    {('P'), QLatin1String("POLYGON")},
-    {('N'), QLatin1String("NATIONAL")},
-    {('N'), QLatin1String("NATURAL")},
-    {('N'), QLatin1String("NCHAR")},
-    {('N'), QLatin1String("NEXT")},
-    {('N'), QLatin1String("NO")},
-    {('N'), QLatin1String("NONCLUSTERED")},
-    {('N'), QLatin1String("NULLIF")},
-    {('N'), QLatin1String("NUMERIC")},
-    {('O'), QLatin1String("OFF")},
-    {('O'), QLatin1String("OFFSETS")},
-    {('O'), QLatin1String("ON")},
-    {('O'), QLatin1String("OPENDATASOURCE")},
-    {('Q'), QLatin1String("QUERY")},
-    {('R'), QLatin1String("ROWSET")},
-    {('O'), QLatin1String("OPTIMIZE")},
-    {('O'), QLatin1String("OPTIONALLY")},
-    {('O'), QLatin1String("ORDER")},
-    {('O'), QLatin1String("OUTER")},
-    {('F'), QLatin1String("FILE")},
-    {('O'), QLatin1String("OVER")},
-    {('P'), QLatin1String("PARTIAL")},
-    {('P'), QLatin1String("PARTITION")},
-    {('P'), QLatin1String("PERCENT")},
-    {('P'), QLatin1String("PIVOT")},
-    {('P'), QLatin1String("PLAN")},
-    {('P'), QLatin1String("POINT")},
-    {('P'), QLatin1String("POLYGON")},
-    {('P'), QLatin1String("PRECEDING")},
-    {('P'), QLatin1String("PRECISION")},
-    {('P'), QLatin1String("PREPARE")},
-    {('P'), QLatin1String("PREV")},
-    {('P'), QLatin1String("PRIMARY")},
-    {('P'), QLatin1String("PRINT")},
-    {('P'), QLatin1String("PRIVILEGES")},
-    {('P'), QLatin1String("PROCEDURE")},
-    {('P'), QLatin1String("PUBLIC")},
-    {('P'), QLatin1String("PURGE")},
-    {('Q'), QLatin1String("QUICK")},
-    {('R'), QLatin1String("RAISERROR")},
-    {('R'), QLatin1String("READS")},
-    {('R'), QLatin1String("REAL")},
-    {('R'), QLatin1String("RECONFIGURE")},
-    {('R'), QLatin1String("REFERENCES")},
-    {('R'), QLatin1String("RELEASE")},
-    {('R'), QLatin1String("RENAME")},
-    {('R'), QLatin1String("REPEATABLE")},
-    {('R'), QLatin1String("REPLACE")},
-    {('R'), QLatin1String("REPLICATION")},
-    {('R'), QLatin1String("REQUIRE")},
-    {('R'), QLatin1String("RESIGNAL")},
-    {('R'), QLatin1String("RESTORE")},
-    {('R'), QLatin1String("RESTRICT")},
-    {('R'), QLatin1String("RETURNS")},
-    {('R'), QLatin1String("REVOKE")},
-    {('R'), QLatin1String("RIGHT")},
-    {('R'), QLatin1String("ROLLBACK")},
-    {('R'), QLatin1String("ROUTINE")},
-    {('R'), QLatin1String("ROWCOUNT")},
-    {('G'), QLatin1String("GUIDCOL")},
-    {('R'), QLatin1String("RTREE")},
-    {('R'), QLatin1String("RULE")},
-    {('S'), QLatin1String("SAVEPOINT")},
-    {('S'), QLatin1String("SCHEMA")},
-    {('S'), QLatin1String("SECOND")},
-    {('S'), QLatin1String("SELECT")},
-    {('S'), QLatin1String("SERIALIZABLE")},
-    {('S'), QLatin1String("SESSION_USER")},
-    {('S'), QLatin1String("SETUSER")},
-    {('S'), QLatin1String("SHARE")},
-    {('S'), QLatin1String("SHOW")},
-    {('S'), QLatin1String("SHUTDOWN")},
-    {('S'), QLatin1String("SIMPLE")},
-    {('S'), QLatin1String("SMALLINT")},
-    {('S'), QLatin1String("SNAPSHOT")},
-    {('S'), QLatin1String("SOME")},
-    {('S'), QLatin1String("SONAME")},
-    {('S'), QLatin1String("SQL")},
-    {('S'), QLatin1String("STARTING")},
-    {('S'), QLatin1String("STATISTICS")},
-    {('S'), QLatin1String("STATUS")},
-    {('S'), QLatin1String("STRIPED")},
-    {('S'), QLatin1String("SYSTEM_USER")},
-    {('T'), QLatin1String("TABLES")},
-    {('T'), QLatin1String("TABLESPACE")},
-    {('T'), QLatin1String("TEMPORARY")},
-    {('T'), QLatin1String("TABLE")},
-    {('T'), QLatin1String("TERMINATED")},
-    {('T'), QLatin1String("TEXTSIZE")},
-    {('T'), QLatin1String("THEN")},
-    {('T'), QLatin1String("TIMESTAMP")},
-    {('T'), QLatin1String("TINYBLOB")},
-    {('I'), QLatin1String("INT")},
-    {('T'), QLatin1String("TEXT")},
-    {('T'), QLatin1String("TOP")},
-    {('T'), QLatin1String("TRANSACTIONS")},
-    {('T'), QLatin1String("TRIGGER")},
-    {('T'), QLatin1String("TRUNCATE")},
-    {('T'), QLatin1String("TSEQUAL")},
-    {('T'), QLatin1String("TYPES")},
-    {('U'), QLatin1String("UNBOUNDED")},
-    {('U'), QLatin1String("UNCOMMITTED")},
-    {('U'), QLatin1String("UNDEFINED")},
-    {('U'), QLatin1String("UNION")},
-    {('U'), QLatin1String("UNIQUE")},
-    {('U'), QLatin1String("UNLOCK")},
-    {('U'), QLatin1String("UNPIVOT")},
-    {('U'), QLatin1String("UNSIGNED")},
-    {('U'), QLatin1String("UPDATETEXT")},
-    {('U'), QLatin1String("USAGE")},
-    {('U'), QLatin1String("USE")},
-    {('U'), QLatin1String("USER")},
-    {('U'), QLatin1String("USING")},
-    {('V'), QLatin1String("VALUES")},
-    {('V'), QLatin1String("VARBINARY")},
-    {('C'), QLatin1String("CHAR")},
-    {('C'), QLatin1String("CHARACTER")},
-    {('Y'), QLatin1String("YING")},
-    {('V'), QLatin1String("VIEW")},
-    {('W'), QLatin1String("WAITFOR")},
-    {('W'), QLatin1String("WARNINGS")},
-    {('W'), QLatin1String("WHEN")},
-    {('W'), QLatin1String("WHERE")},
-    {('W'), QLatin1String("WHILE")},
-    {('W'), QLatin1String("WITH")},
-    {('R'), QLatin1String("ROLLUP")},
-    {('I'), QLatin1String("IN")},
-    {('W'), QLatin1String("WORK")},
-    {('W'), QLatin1String("WRITETEXT")},
-    {('Y'), QLatin1String("YEAR")}
-};
-
-static const QMultiHash<char, QLatin1String> sql_types = {
-
-};
-
-static const QMultiHash<char, QLatin1String> sql_literals = {
-    {('A'), QLatin1String("TRUE")},
-    {('F'), QLatin1String("FALSE")},
-    {('N'), QLatin1String("NULL")},
-};
-
-static const QMultiHash<char, QLatin1String> sql_builtin = {
-    {('A'), QLatin1String("AVG")},
-    {('C'), QLatin1String("COUNT")},
-    {('F'), QLatin1String("FIRST")},
-    {('F'), QLatin1String("FORMAT")},
-    {('L'), QLatin1String("LAST")},
-    {('L'), QLatin1String("LCASE")},
-    {('L'), QLatin1String("LEN")},
-    {('M'), QLatin1String("MAX")},
-    {('M'), QLatin1String("MID")},
-    {('M'), QLatin1String("MIN")},
-    {('M'), QLatin1String("MOD")},
-    {('N'), QLatin1String("NOW")},
-    {('R'), QLatin1String("ROUND")},
-    {('S'), QLatin1String("SUM")},
-    {('U'), QLatin1String("UCASE")}
-};
-
-static const QMultiHash<char, QLatin1String> sql_other = {
-
-};
-
-void loadSQLData(QMultiHash<char, QLatin1String> &types,
-             QMultiHash<char, QLatin1String> &keywords,
-             QMultiHash<char, QLatin1String> &builtin,
-             QMultiHash<char, QLatin1String> &literals,
-             QMultiHash<char, QLatin1String> &other){
-    types = sql_types;
-    keywords = sql_keywords;
-    builtin = sql_builtin;
-    literals = sql_literals;
-    other = sql_other;
-}
+static constexpr KeywordTable::Word sql_words[] = {
+    {"AS", KeywordTable::Keyword},
+    {"ADD", KeywordTable::Keyword},
+    {"ALL", KeywordTable::Keyword},
+    {"ANY", KeywordTable::Keyword},
+    {"ASC", KeywordTable::Keyword},
+    {"AVG", KeywordTable::BuiltIn},
+    {"AFTER", KeywordTable::Keyword},
+    {"ALTER", KeywordTable::Keyword},
+    {"APPLY", KeywordTable::Keyword},
+    {"ACTION", KeywordTable::Keyword},
+    {"ANALYZE", KeywordTable::Keyword},
+    {"ALGORITHM", KeywordTable::Keyword},
+    {"AUTHORIZATION", KeywordTable::Keyword},
+    {"AUTO_INCREMENT", KeywordTable::Keyword},
+    {"BY", KeywordTable::Keyword},
+    {"BDB", KeywordTable::Keyword},
+    {"BIT", KeywordTable::Keyword},
+    {"BLOB", KeywordTable::Keyword},
+    {"BOOL", KeywordTable::Keyword},
+    {"BULK", KeywordTable::Keyword},
+    {"BEGIN", KeywordTable::Keyword},
+    {"BREAK", KeywordTable::Keyword},
+    {"BTREE", KeywordTable::Keyword},
+    {"BACKUP", KeywordTable::Keyword},
+    {"BIGINT", KeywordTable::Keyword},
+    {"BINARY", KeywordTable::Keyword},
+    {"BROWSE", KeywordTable::Keyword},
+    {"BOOLEAN", KeywordTable::Keyword},
+    {"BERKELEYDB", KeywordTable::Keyword},
+    {"COL", KeywordTable::Keyword},
+    {"CALL", KeywordTable::Keyword},
+    {"CASE", KeywordTable::Keyword},
+    {"CHAR", KeywordTable::Keyword},
+    {"CHAIN", KeywordTable::Keyword},
+    {"CLOSE", KeywordTable::Keyword},
+    {"COUNT", KeywordTable::BuiltIn},
+    {"CROSS", KeywordTable::Keyword},
+    {"CYCLE", KeywordTable::Keyword},
+    {"CREATE", KeywordTable::Keyword},
+    {"CURSOR", KeywordTable::Keyword},
+    {"COLLATE", KeywordTable::Keyword},
+    {"COLUMNS", KeywordTable::Keyword},
+    {"COMMENT", KeywordTable::Keyword},
+    {"COMPUTE", KeywordTable::Keyword},
+    {"CONNECT", KeywordTable::Keyword},
+    {"CONVERT", KeywordTable::Keyword},
+    {"CASCADED", KeywordTable::Keyword},
+    {"COALESCE", KeywordTable::Keyword},
+    {"CONTINUE", KeywordTable::Keyword},
+    {"CHARACTER", KeywordTable::Keyword},
+    {"CLUSTERED", KeywordTable::Keyword},
+    {"COMMITTED", KeywordTable::Keyword},
+    {"CHECKPOINT", KeywordTable::Keyword},
+    {"CONSISTENT", KeywordTable::Keyword},
+    {"CONSTRAINT", KeywordTable::Keyword},
+    {"CURRENT_DATE", KeywordTable::Keyword},
+    {"CONTAINSTABLE", KeywordTable::Keyword},
+    {"DO", KeywordTable::Keyword},
+    {"DAY", KeywordTable::Keyword},
+    {"DEC", KeywordTable::Keyword},
+    {"DBCC", KeywordTable::Keyword},
+    {"DENY", KeywordTable::Keyword},
+    {"DESC", KeywordTable::Keyword},
+    {"DISK", KeywordTable::Keyword},
+    {"DROP", KeywordTable::Keyword},
+    {"DUMMY", KeywordTable::Keyword},
+    {"DELETE", KeywordTable::Keyword},
+    {"DOUBLE", KeywordTable::Keyword},
+    {"DECIMAL", KeywordTable::Keyword},
+    {"DECLARE", KeywordTable::Keyword},
+    {"DEFAULT", KeywordTable::Keyword},
+    {"DEFINER", KeywordTable::Keyword},
+    {"DELAYED", KeywordTable::Keyword},
+    {"DISABLE", KeywordTable::Keyword},
+    {"DISCARD", KeywordTable::Keyword},
+    {"DATETIME", KeywordTable::Keyword},
+    {"DESCRIBE", KeywordTable::Keyword},
+    {"DISTINCT", KeywordTable::Keyword},
+    {"DUMPFILE", KeywordTable::Keyword},
+    {"DATABASES", KeywordTable::Keyword},
+    {"DUPLICATE", KeywordTable::Keyword},
+    {"DEALLOCATE", KeywordTable::Keyword},
+    {"DELIMITERS", KeywordTable::Keyword},
+    {"DISTINCTROW", KeywordTable::Keyword},
+    {"DISTRIBUTED", KeywordTable::Keyword},
+    {"DETERMINISTIC", KeywordTable::Keyword},
+    {"END", KeywordTable::Keyword},
+    {"EACH", KeywordTable::Keyword},
+    {"ENUM", KeywordTable::Keyword},
+    {"EXIT", KeywordTable::Keyword},
+    {"ELSEIF", KeywordTable::Keyword},
+    {"ENABLE", KeywordTable::Keyword},
+    {"ENGINE", KeywordTable::Keyword},
+    {"ERRLVL", KeywordTable::Keyword},
+    {"ERRORS", KeywordTable::Keyword},
+    {"EXCEPT", KeywordTable::Keyword},
+    {"EXISTS", KeywordTable::Keyword},
+    {"ESCAPED", KeywordTable::Keyword},
+    {"EXECUTE", KeywordTable::Keyword},
+    {"EXPLAIN", KeywordTable::Keyword},
+    {"ENCLOSED", KeywordTable::Keyword},
+    {"EXTENDED", KeywordTable::Keyword},
+    {"FOR", KeywordTable::Keyword},
+    {"FILE", KeywordTable::Keyword},
+    {"FROM", KeywordTable::Keyword},
+    {"FULL", KeywordTable::Keyword},
+    {"FALSE", KeywordTable::Literal},
+    {"FETCH", KeywordTable::Keyword},
+    {"FIRST", KeywordTable::Keyword},
+    {"FIXED", KeywordTable::Keyword},
+    {"FLOAT", KeywordTable::Keyword},
+    {"FORCE", KeywordTable::Keyword},
+    {"FIELDS", KeywordTable::Keyword},
+    {"FORMAT", KeywordTable::BuiltIn},
+    {"FOREIGN", KeywordTable::Keyword},
+    {"FUNCTION", KeywordTable::Keyword},
+    {"FOLLOWING", KeywordTable::Keyword},
+    {"FILLFACTOR", KeywordTable::Keyword},
+    {"FREETEXTTABLE", KeywordTable::Keyword},
+    {"GOTO", KeywordTable::Keyword},
+    {"GRANT", KeywordTable::Keyword},
+    {"GROUP", KeywordTable::Keyword},
+    {"GLOBAL", KeywordTable::Keyword},
+    {"GUIDCOL", KeywordTable::Keyword},
+    {"GEOMETRYCOLLECTION", KeywordTable::Keyword},
+    {"HASH", KeywordTable::Keyword},
+    {"HOUR", KeywordTable::Keyword},
+    {"HAVING", KeywordTable::Keyword},
+    {"HANDLER", KeywordTable::Keyword},
+    {"HOLDLOCK", KeywordTable::Keyword},
+    {"IF", KeywordTable::Keyword},
+    {"IN", KeywordTable::Keyword},
+    {"INT", KeywordTable::Keyword},
+    {"INTO", KeywordTable::Keyword},
+    {"INDEX", KeywordTable::Keyword},
+    {"INNER", KeywordTable::Keyword},
+    {"INOUT", KeywordTable::Keyword},
+    {"IGNORE", KeywordTable::Keyword},
+    {"IMPORT", KeywordTable::Keyword},
+    {"INFILE", KeywordTable::Keyword},
+    {"INNODB", KeywordTable::Keyword},
+    {"INSERT", KeywordTable::Keyword},
+    {"INTEGER", KeywordTable::Keyword},
+    {"INVOKER", KeywordTable::Keyword},
+    {"ITERATE", KeywordTable::Keyword},
+    {"INTERVAL", KeywordTable::Keyword},
+    {"INTERSECT", KeywordTable::Keyword},
+    {"ISOLATION", KeywordTable::Keyword},
+    {"IDENTITY_INSERT", KeywordTable::Keyword},
+    {"JOIN", KeywordTable::Keyword},
+    {"KEYS", KeywordTable::Keyword},
+    {"KILL", KeywordTable::Keyword},
+    {"LEN", KeywordTable::BuiltIn},
+    {"LAST", KeywordTable::Keyword},
+    {"LEFT", KeywordTable::Keyword},
+    {"LOAD", KeywordTable::Keyword},
+    {"LOCK", KeywordTable::Keyword},
+    {"LOOP", KeywordTable::Keyword},
+    {"LCASE", KeywordTable::BuiltIn},
+    {"LEAVE", KeywordTable::Keyword},
+    {"LEVEL", KeywordTable::Keyword},
+    {"LIMIT", KeywordTable::Keyword},
+    {"LINES", KeywordTable::Keyword},
+    {"LOCAL", KeywordTable::Keyword},
+    {"LINENO", KeywordTable::Keyword},
+    {"LANGUAGE", KeywordTable::Keyword},
+    {"LONGBLOB", KeywordTable::Keyword},
+    {"LINESTRING", KeywordTable::Keyword},
+    {"MAX", KeywordTable::BuiltIn},
+    {"MID", KeywordTable::BuiltIn},
+    {"MIN", KeywordTable::BuiltIn},
+    {"MOD", KeywordTable::BuiltIn},
+    {"MODE", KeywordTable::Keyword},
+    {"MERGE", KeywordTable::Keyword},
+    {"MONTH", KeywordTable::Keyword},
+    {"MINUTE", KeywordTable::Keyword},
+    {"MODIFY", KeywordTable::Keyword},
+    {"MATCHED", KeywordTable::Keyword},
+    {"MODIFIES", KeywordTable::Keyword},
+    {"MIDDLEINT", KeywordTable::Keyword},
+    {"MEDIUMBLOB", KeywordTable::Keyword},
+    {"MULTILINESTRING", KeywordTable::Keyword},
+    {"NO", KeywordTable::Keyword},
+    {"NOW", KeywordTable::BuiltIn},
+    {"NEXT", KeywordTable::Keyword},
+    {"NULL", KeywordTable::Literal},
+    {"NCHAR", KeywordTable::Keyword},
+    {"NULLIF", KeywordTable::Keyword},
+    {"NATURAL", KeywordTable::Keyword},
+    {"NUMERIC", KeywordTable::Keyword},
+    {"NATIONAL", KeywordTable::Keyword},
+    {"NONCLUSTERED", KeywordTable::Keyword},
+    {"ON", KeywordTable::Keyword},
+    {"OFF", KeywordTable::Keyword},
+    {"OVER", KeywordTable::Keyword},
+    {"ORDER", KeywordTable::Keyword},
+    {"OUTER", KeywordTable::Keyword},
+    {"OFFSETS", KeywordTable::Keyword},
+    {"OPTIMIZE", KeywordTable::Keyword},
+    {"OPTIONALLY", KeywordTable::Keyword},
+    {"OPENDATASOURCE", KeywordTable::Keyword},
+    {"PLAN", KeywordTable::Keyword},
+    {"PREV", KeywordTable::Keyword},
+    {"PIVOT", KeywordTable::Keyword},
+    {"POINT", KeywordTable::Keyword},
+    {"PRINT", KeywordTable::Keyword},
+    {"PURGE", KeywordTable::Keyword},
+    {"PUBLIC", KeywordTable::Keyword},
+    {"PARTIAL", KeywordTable::Keyword},
+    {"PERCENT", KeywordTable::Keyword},
+    {"POLYGON", KeywordTable::Keyword},
+    {"PREPARE", KeywordTable::Keyword},
+    {"PRIMARY", KeywordTable::Keyword},
+    {"PARTITION", KeywordTable::Keyword},
+    {"PRECEDING", KeywordTable::Keyword},
+    {"PRECISION", KeywordTable::Keyword},
+    {"PROCEDURE", KeywordTable::Keyword},
+    {"PRIVILEGES", KeywordTable::Keyword},
+    {"QUERY", KeywordTable::Keyword},
+    {"QUICK", KeywordTable::Keyword},
+    {"ROW", KeywordTable::Keyword},
+    {"REAL", KeywordTable::Keyword},
+    {"RULE", KeywordTable::Keyword},
+    {"READS", KeywordTable::Keyword},
+    {"RIGHT", KeywordTable::Keyword},
+    {"ROUND", KeywordTable::BuiltIn},
+    {"RTREE", KeywordTable::Keyword},
+    {"RENAME", KeywordTable::Keyword},
+    {"REVOKE", KeywordTable::Keyword},
+    {"ROLLUP", KeywordTable::Keyword},
+    {"ROWSET", KeywordTable::Keyword},
+    {"RELEASE", KeywordTable::Keyword},
+    {"REPLACE", KeywordTable::Keyword},
+    {"REQUIRE", KeywordTable::Keyword},
+    {"RESTORE", KeywordTable::Keyword},
+    {"RETURNS", KeywordTable::Keyword},
+    {"ROUTINE", KeywordTable::Keyword},
+    {"RESIGNAL", KeywordTable::Keyword},
+    {"RESTRICT", KeywordTable::Keyword},
+    {"ROLLBACK", KeywordTable::Keyword},
+    {"ROWCOUNT", KeywordTable::Keyword},
+    {"RAISERROR", KeywordTable::Keyword},
+    {"REFERENCES", KeywordTable::Keyword},
+    {"REPEATABLE", KeywordTable::Keyword},
+    {"RECONFIGURE", KeywordTable::Keyword},
+    {"REPLICATION", KeywordTable::Keyword},
+    {"SET", KeywordTable::Keyword},
+    {"SQL", KeywordTable::Keyword},
+    {"SUM", KeywordTable::BuiltIn},
+    {"SHOW", KeywordTable::Keyword},
+    {"SOME", KeywordTable::Keyword},
+    {"SHARE", KeywordTable::Keyword},
+    {"SCHEMA", KeywordTable::Keyword},
+    {"SECOND", KeywordTable::Keyword},
+    {"SELECT", KeywordTable::Keyword},
+    {"SIMPLE", KeywordTable::Keyword},
+    {"SONAME", KeywordTable::Keyword},
+    {"STATUS", KeywordTable::Keyword},
+    {"SETUSER", KeywordTable::Keyword},
+    {"STRIPED", KeywordTable::Keyword},
+    {"SHUTDOWN", KeywordTable::Keyword},
+    {"SMALLINT", KeywordTable::Keyword},
+    {"SNAPSHOT", KeywordTable::Keyword},
+    {"STARTING", KeywordTable::Keyword},
+    {"SAVEPOINT", KeywordTable::Keyword},
+    {"STATISTICS", KeywordTable::Keyword},
+    {"SYSTEM_USER", KeywordTable::Keyword},
+    {"SERIALIZABLE", KeywordTable::Keyword},
+    {"SESSION_USER", KeywordTable::Keyword},
+    {"TOP", KeywordTable::Keyword},
+    {"TEXT", KeywordTable::Keyword},
+    {"THEN", KeywordTable::Keyword},
+    {"TRUE", KeywordTable::Literal},
+    {"TABLE", KeywordTable::Keyword},
+    {"TYPES", KeywordTable::Keyword},
+    {"TABLES", KeywordTable::Keyword},
+    {"TRIGGER", KeywordTable::Keyword},
+    {"TSEQUAL", KeywordTable::Keyword},
+    {"TEXTSIZE", KeywordTable::Keyword},
+    {"TINYBLOB", KeywordTable::Keyword},
+    {"TRUNCATE", KeywordTable::Keyword},
+    {"TEMPORARY", KeywordTable::Keyword},
+    {"TIMESTAMP", KeywordTable::Keyword},
+    {"TABLESPACE", KeywordTable::Keyword},
+    {"TERMINATED", KeywordTable::Keyword},
+    {"TRANSACTIONS", KeywordTable::Keyword},
+    {"USE", KeywordTable::Keyword},
+    {"USER", KeywordTable::Keyword},
+    {"UCASE", KeywordTable::BuiltIn},
+    {"UNION", KeywordTable::Keyword},
+    {"USAGE", KeywordTable::Keyword},
+    {"USING", KeywordTable::Keyword},
+    {"UNIQUE", KeywordTable::Keyword},
+    {"UNLOCK", KeywordTable::Keyword},
+    {"UNPIVOT", KeywordTable::Keyword},
+    {"UNSIGNED", KeywordTable::Keyword},
+    {"UNBOUNDED", KeywordTable::Keyword},
+    {"UNDEFINED", KeywordTable::Keyword},
+    {"UPDATETEXT", KeywordTable::Keyword},
+    {"UNCOMMITTED", KeywordTable::Keyword},
+    {"VIEW", KeywordTable::Keyword},
+    {"VALUES", KeywordTable::Keyword},
+    {"VARBINARY", KeywordTable::Keyword},
+    {"WHEN", KeywordTable::Keyword},
+    {"WITH", KeywordTable::Keyword},
+    {"WORK", KeywordTable::Keyword},
+    {"WHERE", KeywordTable::Keyword},
+    {"WHILE", KeywordTable::Keyword},
+    {"WAITFOR", KeywordTable::Keyword},
+    {"WARNINGS", KeywordTable::Keyword},
+    {"WRITETEXT", KeywordTable::Keyword},
+    {"YEAR", KeywordTable::Keyword},
+    {"YING", KeywordTable::Keyword},
+    {"_TIME", KeywordTable::Keyword},
+    {"_USER", KeywordTable::Keyword},
+    {"_TIMESTAMP", KeywordTable::Keyword}
+};
+static_assert(KeywordTable::isSorted(sql_words), "sql_words isn't sorted");
+static constexpr KeywordTable sqlWords(sql_words);
 
 /********************************************************/
 /***   JSON DATA      ***********************************/
 /********************************************************/
 
-static const QMultiHash<char, QLatin1String> json_keywords = {
-};
-
-static const QMultiHash<char, QLatin1String> json_types = {
-};
-
-static const QMultiHash<char, QLatin1String> json_literals = {
-    {('f'), QLatin1String("false")},
-    {('t'), QLatin1String("true")},
-    {('n'), QLatin1String("null")}
+static constexpr KeywordTable::Word json_words[] = {
+    {"false", KeywordTable::Literal},
+    {"null", KeywordTable::Literal},
+    {"true", KeywordTable::Literal}
 };
-
-static const QMultiHash<char, QLatin1String> json_builtin = {
-};
-
-static const QMultiHash<char, QLatin1String> json_other = {
-};
-
-void loadJSONData(QMultiHash<char, QLatin1String> &types,
-             QMultiHash<char, QLatin1String> &keywords,
-             QMultiHash<char, QLatin1String> &builtin,
-             QMultiHash<char, QLatin1String> &literals,
-             QMultiHash<char, QLatin1String> &other){
-    types = json_types;
-    keywords = json_keywords;
-    builtin = json_builtin;
-    literals = json_literals;
-    other = json_other;
-}
+static_assert(KeywordTable::isSorted(json_words), "json_words isn't sorted");
+static constexpr KeywordTable jsonWords(json_words);
 
 /********************************************************/
 /***   CSS DATA      ***********************************/
 /********************************************************/
 
-static const QMultiHash<char, QLatin1String> css_keywords = {
-    {'i', QLatin1String("important")},
-    {'p', QLatin1String("px")},
-    {'e', QLatin1String("em")}
-};
-
-static const QMultiHash<char, QLatin1String> css_types = {
-    {'a', QLatin1String("align")},
-    {'c', QLatin1String("content")},
-    {'i', QLatin1String("items")},
-    {'s', QLatin1String("self")},
-    {'a', QLatin1String("all")},
-    {'a', QLatin1String("animation")},
-    {'d', QLatin1String("delay")},
-    {'d', QLatin1String("direction")},
-    {'d', QLatin1String("duration")},
-    {'f', QLatin1String("fill")},
-    {'m', QLatin1String("mode")},
-    {'i', QLatin1String("iteration")},
-    {'c', QLatin1String("count")},
-    {'n', QLatin1String("name")},
-    {'p', QLatin1String("play")},
-    {'s', QLatin1String("state")},
-    {'t', QLatin1String("timing")},
-    {'f', QLatin1String("function")},
-    {'a', QLatin1String("azimuth")},
-    {'b', QLatin1String("backface")},
-    {'v', QLatin1String("visibility")},
-    {'a', QLatin1String("attachment")},
-    {'b', QLatin1String("blend")},
-    {'m', QLatin1String("mode")},
-    {'c', QLatin1String("clip")},
-    {'c', QLatin1String("color")},
-    {'i', QLatin1String("image")},
-    {'o', QLatin1String("origin")},
-    {'p', QLatin1String("position")},
-    {'r', QLatin1String("repeat")},
-    {'s', QLatin1String("size")},
-    {'b', QLatin1String("background")},
-    {'b', QLatin1String("bleed")},
-    {'c', QLatin1String("color")},
-    {'r', QLatin1String("radius")},
-    {'r', QLatin1String("radius")},
-    {'s', QLatin1String("style")},
-    {'w', QLatin1String("width")},
-    {'b', QLatin1String("bottom")},
-    {'c', QLatin1String("collapse")},
-    {'c', QLatin1String("color")},
-    {'i', QLatin1String("image")},
-    {'o', QLatin1String("outset")},
-    {'r', QLatin1String("repeat")},
-    {'s', QLatin1String("source")},
-    {'s', QLatin1String("slice")},
-    {'w', QLatin1String("width")},
-    {'c', QLatin1String("color")},
-    {'s', QLatin1String("style")},
-    {'w', QLatin1String("width")},
-    {'l', QLatin1String("left")},
-    {'r', QLatin1String("radius")},
-    {'c', QLatin1String("color")},
-    {'s', QLatin1String("style")},
-    {'w', QLatin1String("width")},
-    {'r', QLatin1String("right")},
-    {'s', QLatin1String("spacing")},
-    {'s', QLatin1String("style")},
-    {'c', QLatin1String("color")},
-    {'l', QLatin1String("left")},
-    {'r', QLatin1String("radius")},
-    {'r', QLatin1String("radius")},
-    {'s', QLatin1String("style")},
-    {'w', QLatin1String("width")},
-    {'t', QLatin1String("top")},
-    {'w', QLatin1String("width")},
-    {'b', QLatin1String("border")},
-    {'b', QLatin1String("bottom")},
-    {'b', QLatin1String("break")},
-    {'b', QLatin1String("box")},
-    {'s', QLatin1String("shadow")},
-    {'b', QLatin1String("box")},
-    {'s', QLatin1String("sizing")},
-    {'a', QLatin1String("after")},
-    {'b', QLatin1String("before")},
-    {'b', QLatin1String("break")},
-    {'i', QLatin1String("inside")},
-    {'c', QLatin1String("caption")},
-    {'s', QLatin1String("side")},
-    {'c', QLatin1String("caret")},
-    {'c', QLatin1String("color")},
-    {'c', QLatin1String("clear")},
-    {'c', QLatin1String("clip")},
-    {'c', QLatin1String("color")},
-    {'c', QLatin1String("columns")},
-    {'c', QLatin1String("column")},
-    {'c', QLatin1String("count")},
-    {'f', QLatin1String("fill")},
-    {'g', QLatin1String("gap")},
-    {'r', QLatin1String("rule")},
-    {'c', QLatin1String("color")},
-    {'s', QLatin1String("style")},
-    {'w', QLatin1String("width")},
-    {'s', QLatin1String("span")},
-    {'w', QLatin1String("width")},
-    {'c', QLatin1String("content")},
-    {'i', QLatin1String("increment")},
-    {'c', QLatin1String("counter")},
-    {'r', QLatin1String("reset")},
-    {'a', QLatin1String("after")},
-    {'b', QLatin1String("before")},
-    {'c', QLatin1String("cue")},
-    {'c', QLatin1String("cursor")},
-    {'d', QLatin1String("direction")},
-    {'d', QLatin1String("display")},
-    {'e', QLatin1String("elevation")},
-    {'e', QLatin1String("empty")},
-    {'c', QLatin1String("cells")},
-    {'f', QLatin1String("filter")},
-    {'f', QLatin1String("flex")},
-    {'b', QLatin1String("basis")},
-    {'d', QLatin1String("direction")},
-    {'f', QLatin1String("feature")},
-    {'s', QLatin1String("settings")},
-    {'f', QLatin1String("flex")},
-    {'f', QLatin1String("flow")},
-    {'g', QLatin1String("grow")},
-    {'s', QLatin1String("shrink")},
-    {'w', QLatin1String("wrap")},
-    {'f', QLatin1String("float")},
-    {'f', QLatin1String("family")},
-    {'k', QLatin1String("kerning")},
-    {'l', QLatin1String("language")},
-    {'o', QLatin1String("override")},
-    {'a', QLatin1String("adjust")},
-    {'s', QLatin1String("size")},
-    {'s', QLatin1String("stretch")},
-    {'s', QLatin1String("style")},
-    {'s', QLatin1String("synthesis")},
-    {'v', QLatin1String("variant")},
-    {'a', QLatin1String("alternates")},
-    {'c', QLatin1String("caps")},
-    {'e', QLatin1String("east")},
-    {'a', QLatin1String("asian")},
-    {'l', QLatin1String("ligatures")},
-    {'n', QLatin1String("numeric")},
-    {'p', QLatin1String("position")},
-    {'w', QLatin1String("weight")},
-    {'f', QLatin1String("font")},
-    {'a', QLatin1String("area")},
-    {'a', QLatin1String("auto")},
-    {'c', QLatin1String("columns")},
-    {'f', QLatin1String("flow")},
-    {'r', QLatin1String("rows")},
-    {'e', QLatin1String("end")},
-    {'g', QLatin1String("gap")},
-    {'s', QLatin1String("start")},
-    {'c', QLatin1String("column")},
-    {'g', QLatin1String("gap")},
-    {'e', QLatin1String("end")},
-    {'g', QLatin1String("gap")},
-    {'s', QLatin1String("start")},
-    {'r', QLatin1String("row")},
-    {'a', QLatin1String("areas")},
-    {'c', QLatin1String("columns")},
-    {'r', QLatin1String("rows")},
-    {'t', QLatin1String("template")},
-    {'g', QLatin1String("grid")},
-    {'h', QLatin1String("hanging")},
-    {'p', QLatin1String("punctuation")},
-    {'h', QLatin1String("height")},
-    {'h', QLatin1String("hyphens")},
-    {'i', QLatin1String("isolation")},
-    {'j', QLatin1String("justify")},
-    {'c', QLatin1String("content")},
-    {'i', QLatin1String("items")},
-    {'s', QLatin1String("self")},
-    {'l', QLatin1String("leftimage")},
-    {'l', QLatin1String("letter")},
-    {'s', QLatin1String("spacing")},
-    {'b', QLatin1String("break")},
-    {'l', QLatin1String("line")},
-    {'s', QLatin1String("style")},
-    {'i', QLatin1String("image")},
-    {'s', QLatin1String("style")},
-    {'p', QLatin1String("position")},
-    {'t', QLatin1String("type")},
-    {'l', QLatin1String("list")},
-    {'s', QLatin1String("style")},
-    {'b', QLatin1String("bottom")},
-    {'l', QLatin1String("left")},
-    {'r', QLatin1String("right")},
-    {'t', QLatin1String("top")},
-    {'m', QLatin1String("margin")},
-    {'m', QLatin1String("marker")},
-    {'o', QLatin1String("offset")},
-    {'m', QLatin1String("marks")},
-    {'m', QLatin1String("max")},
-    {'h', QLatin1String("height")},
-    {'w', QLatin1String("width")},
-    {'m', QLatin1String("min")},
-    {'m', QLatin1String("mix")},
-    {'b', QLatin1String("blend")},
-    {'m', QLatin1String("mode")},
-    {'n', QLatin1String("nav")},
-    {'u', QLatin1String("up")},
-    {'d', QLatin1String("down")},
-    {'l', QLatin1String("left")},
-    {'r', QLatin1String("right")},
-    {'o', QLatin1String("opacity")},
-    {'o', QLatin1String("order")},
-    {'o', QLatin1String("orphans")},
-    {'c', QLatin1String("color")},
-    {'o', QLatin1String("offset")},
-    {'s', QLatin1String("style")},
-    {'w', QLatin1String("width")},
-    {'o', QLatin1String("outline")},
-    {'w', QLatin1String("wrap")},
-    {'o', QLatin1String("overflow")},
-    {'b', QLatin1String("bottom")},
-    {'l', QLatin1String("left")},
-    {'r', QLatin1String("right")},
-    {'t', QLatin1String("top")},
-    {'p', QLatin1String("padding")},
-    {'b', QLatin1String("break")},
-    {'a', QLatin1String("after")},
-    {'b', QLatin1String("before")},
-    {'i', QLatin1String("inside")},
-    {'p', QLatin1String("page")},
-    {'a', QLatin1String("after")},
-    {'b', QLatin1String("before")},
-    {'p', QLatin1String("pause")},
-    {'p', QLatin1String("perspective")},
-    {'o', QLatin1String("origin")},
-    {'r', QLatin1String("range")},
-    {'p', QLatin1String("pitch")},
-    {'c', QLatin1String("content")},
-    {'i', QLatin1String("items")},
-    {'p', QLatin1String("place")},
-    {'s', QLatin1String("self")},
-    {'p', QLatin1String("play")},
-    {'d', QLatin1String("during")},
-    {'p', QLatin1String("position")},
-    {'q', QLatin1String("quotes")},
-    {'r', QLatin1String("resize")},
-    {'r', QLatin1String("rest")},
-    {'a', QLatin1String("after")},
-    {'b', QLatin1String("before")},
-    {'r', QLatin1String("rest")},
-    {'r', QLatin1String("richness")},
-    {'r', QLatin1String("right")},
-    {'s', QLatin1String("size")},
-    {'h', QLatin1String("header")},
-    {'n', QLatin1String("numeral")},
-    {'s', QLatin1String("speak")},
-    {'p', QLatin1String("punctuation")},
-    {'s', QLatin1String("speak")},
-    {'s', QLatin1String("speech")},
-    {'r', QLatin1String("rate")},
-    {'s', QLatin1String("stress")},
-    {'t', QLatin1String("tab")},
-    {'s', QLatin1String("size")},
-    {'t', QLatin1String("table")},
-    {'l', QLatin1String("layout")},
-    {'t', QLatin1String("text")},
-    {'a', QLatin1String("align")},
-    {'l', QLatin1String("last")},
-    {'d', QLatin1String("decoration")},
-    {'c', QLatin1String("color")},
-    {'l', QLatin1String("line")},
-    {'s', QLatin1String("skip")},
-    {'s', QLatin1String("style")},
-    {'i', QLatin1String("indent")},
-    {'o', QLatin1String("overflow")},
-    {'s', QLatin1String("shadow")},
-    {'t', QLatin1String("transform")},
-    {'u', QLatin1String("underline")},
-    {'p', QLatin1String("position")},
-    {'t', QLatin1String("top")},
-    {'t', QLatin1String("transform")},
-    {'o', QLatin1String("origin")},
-    {'s', QLatin1String("style")},
-    {'t', QLatin1String("transition")},
-    {'d', QLatin1String("delay")},
-    {'d', QLatin1String("duration")},
-    {'p', QLatin1String("property")},
-    {'t', QLatin1String("timing")},
-    {'f', QLatin1String("function")},
-    {'u', QLatin1String("unicode")},
-    {'b', QLatin1String("bidi")},
-    {'v', QLatin1String("vertical")},
-    {'a', QLatin1String("align")},
-    {'v', QLatin1String("visibility")},
-    {'b', QLatin1String("balance")},
-    {'d', QLatin1String("duration")},
-    {'f', QLatin1String("family")},
-    {'p', QLatin1String("pitch")},
-    {'r', QLatin1String("range")},
-    {'r', QLatin1String("rate")},
-    {'s', QLatin1String("stress")},
-    {'v', QLatin1String("volume")},
-    {'v', QLatin1String("voice")},
-    {'v', QLatin1String("volume")},
-    {'w', QLatin1String("white")},
-    {'s', QLatin1String("space")},
-    {'w', QLatin1String("widows")},
-    {'w', QLatin1String("width")},
-    {'w', QLatin1String("will")},
-    {'c', QLatin1String("change")},
-    {'w', QLatin1String("word")},
-    {'b', QLatin1String("break")},
-    {'s', QLatin1String("spacing")},
-    {'w', QLatin1String("wrap")},
-    {'x', QLatin1String("x")},
-    {'y', QLatin1String("y")},
-    {'z', QLatin1String("z")},
-    {'i', QLatin1String("index")},
-    {'r', QLatin1String("rgb")},
-    {'s', QLatin1String("sans")},
-    {'s', QLatin1String("serif")},
-    {'n', QLatin1String("normal")}
-};
-
-static const QMultiHash<char, QLatin1String> css_literals = {
-};
-
-static const QMultiHash<char, QLatin1String> css_builtin = {
-};
-
-static const QMultiHash<char, QLatin1String> css_other = {
-};
-
-void loadCSSData(QMultiHash<char, QLatin1String> &types,
-             QMultiHash<char, QLatin1String> &keywords,
-             QMultiHash<char, QLatin1String> &builtin,
-             QMultiHash<char, QLatin1String> &literals,
-             QMultiHash<char, QLatin1String> &other){
-    types = css_types;
-    keywords = css_keywords;
-    builtin = css_builtin;
-    literals = css_literals;
-    other = css_other;
-}
+static constexpr KeywordTable::Word css_words[] = {
+    {"all", KeywordTable::Type},
+    {"area", KeywordTable::Type},
+    {"auto", KeywordTable::Type},
+    {"after", KeywordTable::Type},
+    {"align", KeywordTable::Type},
+    {"areas", KeywordTable::Type},
+    {"asian", KeywordTable::Type},
+    {"adjust", KeywordTable::Type},
+    {"azimuth", KeywordTable::Type},
+    {"animation", KeywordTable::Type},
+    {"alternates", KeywordTable::Type},
+    {"attachment", KeywordTable::Type},
+    {"box", KeywordTable::Type},
+    {"bidi", KeywordTable::Type},
+    {"basis", KeywordTable::Type},
+    {"bleed", KeywordTable::Type},
+    {"blend", KeywordTable::Type},
+    {"break", KeywordTable::Type},
+    {"before", KeywordTable::Type},
+    {"border", KeywordTable::Type},
+    {"bottom", KeywordTable::Type},
+    {"balance", KeywordTable::Type},
+    {"backface", KeywordTable::Type},
+    {"background", KeywordTable::Type},
+    {"cue", KeywordTable::Type},
+    {"caps", KeywordTable::Type},
+    {"clip", KeywordTable::Type},
+    {"caret", KeywordTable::Type},
+    {"cells", KeywordTable::Type},
+    {"clear", KeywordTable::Type},
+    {"color", KeywordTable::Type},
+    {"count", KeywordTable::Type},
+    {"change", KeywordTable::Type},
+    {"column", KeywordTable::Type},
+    {"cursor", KeywordTable::Type},
+    {"caption", KeywordTable::Type},
+    {"columns", KeywordTable::Type},
+    {"content", KeywordTable::Type},
+    {"counter", KeywordTable::Type},
+    {"collapse", KeywordTable::Type},
+    {"down", KeywordTable::Type},
+    {"delay", KeywordTable::Type},
+    {"during", KeywordTable::Type},
+    {"display", KeywordTable::Type},
+    {"duration", KeywordTable::Type},
+    {"direction", KeywordTable::Type},
+    {"decoration", KeywordTable::Type},
+    {"em", KeywordTable::Keyword},
+    {"end", KeywordTable::Type},
+    {"east", KeywordTable::Type},
+    {"empty", KeywordTable::Type},
+    {"elevation", KeywordTable::Type},
+    {"fill", KeywordTable::Type},
+    {"flex", KeywordTable::Type},
+    {"flow", KeywordTable::Type},
+    {"font", KeywordTable::Type},
+    {"float", KeywordTable::Type},
+    {"family", KeywordTable::Type},
+    {"filter", KeywordTable::Type},
+    {"feature", KeywordTable::Type},
+    {"function", KeywordTable::Type},
+    {"gap", KeywordTable::Type},
+    {"grid", KeywordTable::Type},
+    {"grow", KeywordTable::Type},
+    {"header", KeywordTable::Type},
+    {"height", KeywordTable::Type},
+    {"hanging", KeywordTable::Type},
+    {"hyphens", KeywordTable::Type},
+    {"image", KeywordTable::Type},
+    {"index", KeywordTable::Type},
+    {"items", KeywordTable::Type},
+    {"indent", KeywordTable::Type},
+    {"inside", KeywordTable::Type},
+    {"important", KeywordTable::Keyword},
+    {"increment", KeywordTable::Type},
+    {"isolation", KeywordTable::Type},
+    {"iteration", KeywordTable::Type},
+    {"justify", KeywordTable::Type},
+    {"kerning", KeywordTable::Type},
+    {"last", KeywordTable::Type},
+    {"left", KeywordTable::Type},
+    {"line", KeywordTable::Type},
+    {"list", KeywordTable::Type},
+    {"layout", KeywordTable::Type},
+    {"letter", KeywordTable::Type},
+    {"language", KeywordTable::Type},
+    {"leftimage", KeywordTable::Type},
+    {"ligatures", KeywordTable::Type},
+    {"max", KeywordTable::Type},
+    {"min", KeywordTable::Type},
+    {"mix", KeywordTable::Type},
+    {"mode", KeywordTable::Type},
+    {"marks", KeywordTable::Type},
+    {"margin", KeywordTable::Type},
+    {"marker", KeywordTable::Type},
+    {"nav", KeywordTable::Type},
+    {"name", KeywordTable::Type},
+    {"normal", KeywordTable::Type},
+    {"numeral", KeywordTable::Type},
+    {"numeric", KeywordTable::Type},
+    {"order", KeywordTable::Type},
+    {"offset", KeywordTable::Type},
+    {"origin", KeywordTable::Type},
+    {"outset", KeywordTable::Type},
+    {"opacity", KeywordTable::Type},
+    {"orphans", KeywordTable::Type},
+    {"outline", KeywordTable::Type},
+    {"overflow", KeywordTable::Type},
+    {"override", KeywordTable::Type},
+    {"px", KeywordTable::Keyword},
+    {"page", KeywordTable::Type},
+    {"play", KeywordTable::Type},
+    {"pause", KeywordTable::Type},
+    {"pitch", KeywordTable::Type},
+    {"place", KeywordTable::Type},
+    {"padding", KeywordTable::Type},
+    {"position", KeywordTable::Type},
+    {"property", KeywordTable::Type},
+    {"perspective", KeywordTable::Type},
+    {"punctuation", KeywordTable::Type},
+    {"quotes", KeywordTable::Type},
+    {"rgb", KeywordTable::Type},
+    {"row", KeywordTable::Type},
+    {"rate", KeywordTable::Type},
+    {"rest", KeywordTable::Type},
+    {"rows", KeywordTable::Type},
+    {"rule", KeywordTable::Type},
+    {"range", KeywordTable::Type},
+    {"reset", KeywordTable::Type},
+    {"right", KeywordTable::Type},
+    {"radius", KeywordTable::Type},
+    {"repeat", KeywordTable::Type},
+    {"resize", KeywordTable::Type},
+    {"richness", KeywordTable::Type},
+    {"sans", KeywordTable::Type},
+    {"self", KeywordTable::Type},
+    {"side", KeywordTable::Type},
+    {"size", KeywordTable::Type},
+    {"skip", KeywordTable::Type},
+    {"span", KeywordTable::Type},
+    {"serif", KeywordTable::Type},
+    {"slice", KeywordTable::Type},
+    {"space", KeywordTable::Type},
+    {"speak", KeywordTable::Type},
+    {"start", KeywordTable::Type},
+    {"state", KeywordTable::Type},
+    {"style", KeywordTable::Type},
+    {"shadow", KeywordTable::Type},
+    {"shrink", KeywordTable::Type},
+    {"sizing", KeywordTable::Type},
+    {"source", KeywordTable::Type},
+    {"speech", KeywordTable::Type},
+    {"stress", KeywordTable::Type},
+    {"spacing", KeywordTable::Type},
+    {"stretch", KeywordTable::Type},
+    {"settings", KeywordTable::Type},
+    {"synthesis", KeywordTable::Type},
+    {"tab", KeywordTable::Type},
+    {"top", KeywordTable::Type},
+    {"text", KeywordTable::Type},
+    {"type", KeywordTable::Type},
+    {"table", KeywordTable::Type},
+    {"timing", KeywordTable::Type},
+    {"template", KeywordTable::Type},
+    {"transform", KeywordTable::Type},
+    {"transition", KeywordTable::Type},
+    {"up", KeywordTable::Type},
+    {"unicode", KeywordTable::Type},
+    {"underline", KeywordTable::Type},
+    {"voice", KeywordTable::Type},
+    {"volume", KeywordTable::Type},
+    {"variant", KeywordTable::Type},
+    {"vertical", KeywordTable::Type},
+    {"visibility", KeywordTable::Type},
+    {"will", KeywordTable::Type},
+    {"word", KeywordTable::Type},
+    {"wrap", KeywordTable::Type},
+    {"white", KeywordTable::Type},
+    {"width", KeywordTable::Type},
+    {"weight", KeywordTable::Type},
+    {"widows", KeywordTable::Type},
+    {"x", KeywordTable::Type},
+    {"y", KeywordTable::Type},
+    {"z", KeywordTable::Type}
+};
+static_assert(KeywordTable::isSorted(css_words), "css_words isn't sorted");
+static constexpr KeywordTable cssWords(css_words);
 
 /********************************************************/
 /***   Typescript DATA  *********************************/
 /********************************************************/
 
-static const QMultiHash<char, QLatin1String> typescript_keywords = {
-    {'i', QLatin1String("in")},
-    {'i', QLatin1String("if")},
-    {'f', QLatin1String("for")},
-    {'w', QLatin1String("while")},
-    {'f', QLatin1String("finally")},
-    {'n', QLatin1String("new")},
-    {'f', QLatin1String("function")},
-    {'d', QLatin1String("do")},
-    {'r', QLatin1String("return")},
-    {'v', QLatin1String("void")},
-    {'e', QLatin1String("else")},
-    {'b', QLatin1String("break")},
-    {'c', QLatin1String("catch")},
-    {'i', QLatin1String("instanceof")},
-    {'w', QLatin1String("with")},
-    {'t', QLatin1String("throw")},
-    {'c', QLatin1String("case")},
-    {'d', QLatin1String("default")},
-    {'t', QLatin1String("try")},
-    {'t', QLatin1String("this")},
-    {'s', QLatin1String("switch")},
-    {'c', QLatin1String("continue")},
-    {'t', QLatin1String("typeof")},
-    {'d', QLatin1String("delete")},
-    {'l', QLatin1String("let")},
-    {'y', QLatin1String("yield")},
-    {'c', QLatin1String("const")},
-    {'p', QLatin1String("public")},
-    {'p', QLatin1String("private")},
-    {'p', QLatin1String("protected")},
-    {'g', QLatin1String("get")},
-    {'s', QLatin1String("set")},
-    {'s', QLatin1String("super")},
-    {'s', QLatin1String("static")},
-    {'i', QLatin1String("implements")},
-    {'e', QLatin1String("export")},
-    {'i', QLatin1String("import")},
-    {'d', QLatin1String("declare")},
-    {'t', QLatin1String("type")},
-    {'n', QLatin1String("namespace")},
-    {'a', QLatin1String("abstract")},
-    {'a', QLatin1String("as")},
-    {'f', QLatin1String("from")},
-    {'e', QLatin1String("extends")},
-    {'a', QLatin1String("async")},
-    {'a', QLatin1String("await")}
-};
-
-static const QMultiHash<char, QLatin1String> typescript_types = {
-    {'v', QLatin1String("var")},
-    {'c', QLatin1String("class")},
-    {'e', QLatin1String("enum")}
-};
-
-static const QMultiHash<char, QLatin1String> typescript_literals = {
-    {('f'), QLatin1String("false")},
-    {('n'), QLatin1String("null")},
-    {('t'), QLatin1String("true")},
-    {('u'), QLatin1String("undefined")},
-    {('N'), QLatin1String("NaN")},
-    {('I'), QLatin1String("Infinity")}
-};
-
-static const QMultiHash<char, QLatin1String> typescript_builtin = {
-    {'e', QLatin1String("eval")},
-    {'i', QLatin1String("isFinite")},
-    {'i', QLatin1String("isNaN")},
-    {'p', QLatin1String("parseFloat")},
-    {'p', QLatin1String("parseInt")},
-    {'d', QLatin1String("decodeURI")},
-    {'d', QLatin1String("decodeURIComponent")},
-    {'e', QLatin1String("encodeURI")},
-    {'e', QLatin1String("encodeURIComponent")},
-    {'e', QLatin1String("escape")},
-    {'u', QLatin1String("unescape")},
-    {'O', QLatin1String("Object")},
-    {'F', QLatin1String("Function")},
-    {'B', QLatin1String("Boolean")},
-    {'E', QLatin1String("Error")},
-    {'E', QLatin1String("EvalError")},
-    {'I', QLatin1String("InternalError")},
-    {'R', QLatin1String("RangeError")},
-    {'R', QLatin1String("ReferenceError")},
-    {'S', QLatin1String("StopIteration")},
-    {'S', QLatin1String("SyntaxError")},
-    {'T', QLatin1String("TypeError")},
-    {'U', QLatin1String("URIError")},
-    {'N', QLatin1String("Number")},
-    {'M', QLatin1String("Math")},
-    {'D', QLatin1String("Date")},
-    {'S', QLatin1String("String")},
-    {'R', QLatin1String("RegExp")},
-    {'A', QLatin1String("Array")},
-    {'F', QLatin1String("Float32Array")},
-    {'F', QLatin1String("Float64Array")},
-    {'I', QLatin1String("Int16Array")},
-    {'I', QLatin1String("Int32Array")},
-    {'I', QLatin1String("Int8Array")},
-    {'U', QLatin1String("Uint16Array")},
-    {'U', QLatin1String("Uint32Array")},
-    {'U', QLatin1String("Uint8Array")},
-    {'U', QLatin1String("Uint8ClampedArray")},
-    {'A', QLatin1String("ArrayBuffer")},
-    {'D', QLatin1String("DataView")},
-    {'J', QLatin1String("JSON")},
-    {'I', QLatin1String("Intl")},
-    {'a', QLatin1String("arguments")},
-    {'r', QLatin1String("require")},
-    {'m', QLatin1String("module")},
-    {'c', QLatin1String("console")},
-    {'w', QLatin1String("window")},
-    {'d', QLatin1String("document")},
-    {'a', QLatin1String("any")},
-    {'n', QLatin1String("number")},
-    {'b', QLatin1String("boolean")},
-    {'s', QLatin1String("string")},
-    {'v', QLatin1String("void")},
-    {'P', QLatin1String("Promise")}
-};
-
-static const QMultiHash<char, QLatin1String> typescript_other = {
-};
-
-void loadTypescriptData(QMultiHash<char, QLatin1String> &types,
-             QMultiHash<char, QLatin1String> &keywords,
-             QMultiHash<char, QLatin1String> &builtin,
-             QMultiHash<char, QLatin1String> &literals,
-             QMultiHash<char, QLatin1String> &other){
-    types = typescript_types;
-    keywords = typescript_keywords;
-    builtin = typescript_builtin;
-    literals = typescript_literals;
-    other = typescript_other;
-}
+static constexpr KeywordTable::Word typescript_words[] = {
+    {"Array", KeywordTable::BuiltIn},
+    {"ArrayBuffer", KeywordTable::BuiltIn},
+    {"Boolean", KeywordTable::BuiltIn},
+    {"Date", KeywordTable::BuiltIn},
+    {"DataView", KeywordTable::BuiltIn},
+    {"Error", KeywordTable::BuiltIn},
+    {"EvalError", KeywordTable::BuiltIn},
+    {"Function", KeywordTable::BuiltIn},
+    {"Float32Array", KeywordTable::BuiltIn},
+    {"Float64Array", KeywordTable::BuiltIn},
+    {"Intl", KeywordTable::BuiltIn},
+    {"Infinity", KeywordTable::Literal},
+    {"Int8Array", KeywordTable::BuiltIn},
+    {"Int16Array", KeywordTable::BuiltIn},
+    {"Int32Array", KeywordTable::BuiltIn},
+    {"InternalError", KeywordTable::BuiltIn},
+    {"JSON", KeywordTable::BuiltIn},
+    {"Math", KeywordTable::BuiltIn},
+    {"NaN", KeywordTable::Literal},
+    {"Number", KeywordTable::BuiltIn},
+    {"Object", KeywordTable::BuiltIn},
+    {"Promise", KeywordTable::BuiltIn},
+    {"RegExp", KeywordTable::BuiltIn},
+    {"RangeError", KeywordTable::BuiltIn},
+    {"ReferenceError", KeywordTable::BuiltIn},
+    {"String", KeywordTable::BuiltIn},
+    {"SyntaxError", KeywordTable::BuiltIn},
+    {"StopIteration", KeywordTable::BuiltIn},
+    {"TypeError", KeywordTable::BuiltIn},
+    {"URIError", KeywordTable::BuiltIn},
+    {"Uint8Array", KeywordTable::BuiltIn},
+    {"Uint16Array", KeywordTable::BuiltIn},
+    {"Uint32Array", KeywordTable::BuiltIn},
+    {"Uint8ClampedArray", KeywordTable::BuiltIn},
+    {"as", KeywordTable::Keyword},
+    {"any", KeywordTable::BuiltIn},
+    {"async", KeywordTable::Keyword},
+    {"await", KeywordTable::Keyword},
+    {"abstract", KeywordTable::Keyword},
+    {"arguments", KeywordTable::BuiltIn},
+    {"break", KeywordTable::Keyword},
+    {"boolean", KeywordTable::BuiltIn},
+    {"case", KeywordTable::Keyword},
+    {"catch", KeywordTable::Keyword},
+    {"class", KeywordTable::Type},
+    {"const", KeywordTable::Keyword},
+    {"console", KeywordTable::BuiltIn},
+    {"continue", KeywordTable::Keyword},
+    {"do", KeywordTable::Keyword},
+    {"delete", KeywordTable::Keyword},
+    {"declare", KeywordTable::Keyword},
+    {"default", KeywordTable::Keyword},
+    {"document", KeywordTable::BuiltIn},
+    {"decodeURI", KeywordTable::BuiltIn},
+    {"decodeURIComponent", KeywordTable::BuiltIn},
+    {"else", KeywordTable::Keyword},
+    {"enum", KeywordTable::Type},
+    {"eval", KeywordTable::BuiltIn},
+    {"escape", KeywordTable::BuiltIn},
+    {"export", KeywordTable::Keyword},
+    {"extends", KeywordTable::Keyword},
+    {"encodeURI", KeywordTable::BuiltIn},
+    {"encodeURIComponent", KeywordTable::BuiltIn},
+    {"for", KeywordTable::Keyword},
+    {"from", KeywordTable::Keyword},
+    {"false", KeywordTable::Literal},
+    {"finally", KeywordTable::Keyword},
+    {"function", KeywordTable::Keyword},
+    {"get", KeywordTable::Keyword},
+    {"if", KeywordTable::Keyword},
+    {"in", KeywordTable::Keyword},
+    {"isNaN", KeywordTable::BuiltIn},
+    {"import", KeywordTable::Keyword},
+    {"isFinite", KeywordTable::BuiltIn},
+    {"implements", KeywordTable::Keyword},
+    {"instanceof", KeywordTable::Keyword},
+    {"let", KeywordTable::Keyword},
+    {"module", KeywordTable::BuiltIn},
+    {"new", KeywordTable::Keyword},
+    {"null", KeywordTable::Literal},
+    {"number", KeywordTable::BuiltIn},
+    {"namespace", KeywordTable::Keyword},
+    {"public", KeywordTable::Keyword},
+    {"private", KeywordTable::Keyword},
+    {"parseInt", KeywordTable::BuiltIn},
+    {"protected", KeywordTable::Keyword},
+    {"parseFloat", KeywordTable::BuiltIn},
+    {"return", KeywordTable::Keyword},
+    {"require", KeywordTable::BuiltIn},
+    {"set", KeywordTable::Keyword},
+    {"super", KeywordTable::Keyword},
+    {"static", KeywordTable::Keyword},
+    {"string", KeywordTable::BuiltIn},
+    {"switch", KeywordTable::Keyword},
+    {"try", KeywordTable::Keyword},
+    {"this", KeywordTable::Keyword},
+    {"true", KeywordTable::Literal},
+    {"type", KeywordTable::Keyword},
+    {"throw", KeywordTable::Keyword},
+    {"typeof", KeywordTable::Keyword},
+    {"unescape", KeywordTable::BuiltIn},
+    {"undefined", KeywordTable::Literal},
+    {"var", KeywordTable::Type},
+    {"void", KeywordTable::Keyword},
+    {"with", KeywordTable::Keyword},
+    {"while", KeywordTable::Keyword},
+    {"window", KeywordTable::BuiltIn},
+    {"yield", KeywordTable::Keyword}
+};
+static_assert(KeywordTable::isSorted(typescript_words), "typescript_words isn't sorted");
+static constexpr KeywordTable typescriptWords(typescript_words);
 
 /********************************************************/
 /***   YAML DATA  ***************************************/
 /********************************************************/
 
-static const QMultiHash<char, QLatin1String> YAML_keywords = {};
-static const QMultiHash<char, QLatin1String> YAML_types = {};
-static const QMultiHash<char, QLatin1String> YAML_literals = {
-    {('f'), QLatin1String("false")},
-    {('t'), QLatin1String("true")},
-    {('n'), QLatin1String("null")},
-    {('n'), QLatin1String("no")},
-    {('y'), QLatin1String("yes")},
+static constexpr KeywordTable::Word yaml_words[] = {
+    {"false", KeywordTable::Literal},
+    {"no", KeywordTable::Literal},
+    {"null", KeywordTable::Literal},
+    {"true", KeywordTable::Literal},
+    {"yes", KeywordTable::Literal}
 };
-
-static const QMultiHash<char, QLatin1String> YAML_builtin = {};
-static const QMultiHash<char, QLatin1String> YAML_other = {};
-
-void loadYAMLData(QMultiHash<char, QLatin1String> &types,
-             QMultiHash<char, QLatin1String> &keywords,
-             QMultiHash<char, QLatin1String> &builtin,
-             QMultiHash<char, QLatin1String> &literals,
-             QMultiHash<char, QLatin1String> &other){
-    types = YAML_types;
-    keywords = YAML_keywords;
-    builtin = YAML_builtin;
-    literals = YAML_literals;
-    other = YAML_other;
-}
+static_assert(KeywordTable::isSorted(yaml_words), "yaml_words isn't sorted");
+static constexpr KeywordTable yamlWords(yaml_words);
@@ -15,6 +15,7 @@
 #include "ui_mainwindow.h"
 
 #include <QDebug>
+#include <QScrollBar>
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
@@ -27,6 +28,7 @@ MainWindow::MainWindow(QWidget *parent)
     //set highlighter
     highlighter = new QSourceHighliter(ui->plainTextEdit->document());
     highlighter->setCurrentLanguage(QSourceHighliter::CodeCpp);
+    highlighter->setHighlightMode(QSourceHighliter::Asynchronous);
 
     //start with Cpp code
     ui->plainTextEdit->setPlainText(loadCppDemoCode());
@@ -34,6 +36,9 @@ MainWindow::MainWindow(QWidget *parent)
     connect(ui->langComboBox,
             static_cast<void (QComboBox::*) (int)>(&QComboBox::currentIndexChanged),
             this, &MainWindow::languageChanged);
+    connect(ui->plainTextEdit->verticalScrollBar(), &QScrollBar::valueChanged,
+            this, &MainWindow::updateVisibleBlocks);
+    updateVisibleBlocks();
 }
 
 MainWindow::~MainWindow()
@@ -59,6 +64,14 @@ void MainWindow::initComboBox() {
     ui->langComboBox->addItem("YAML", QSourceHighliter::CodeYAML);
     ui->langComboBox->addItem("XML", QSourceHighliter::CodeXML);
     ui->langComboBox->addItem("ini", QSourceHighliter::CodeINI);
+    ui->langComboBox->addItem("Markdown", QSourceHighliter::CodeMarkdown);
+}
+
+void MainWindow::updateVisibleBlocks() {
+    const QPlainTextEdit *edit = ui->plainTextEdit;
+    const int first = edit->cursorForPosition(QPoint(0, 0)).blockNumber();
+    const int last = edit->cursorForPosition(QPoint(0, edit->viewport()->height())).blockNumber();
+    highlighter->setVisibleBlocks(first, last);
 }
 
 void MainWindow::languageChanged(int) {
@@ -43,6 +43,7 @@ private:
 
 private slots:
     void languageChanged(int);
+    void updateVisibleBlocks();
 
 };
 #endif // MAINWINDOW_H
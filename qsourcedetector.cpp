@@ -0,0 +1,493 @@
+/*
+ * Copyright (c) 2019 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 3 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ */
+#include "qsourcedetector.h"
+#include "keywordtable.h"
+
+using Language = QSourceLexer::Language;
+
+/* every language has a slot, CodeCpp is the first value and they are
+ * two apart */
+static const int slotCount = (QSourceLexer::CodeMarkdown - QSourceLexer::CodeCpp) / 2 + 1;
+
+static inline int slot(int language) {
+    return (language - QSourceLexer::CodeCpp) / 2;
+}
+
+static inline bool isWordStart(ushort c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+static inline bool isWordChar(ushort c) {
+    return isWordStart(c) || (c >= '0' && c <= '9');
+}
+
+/* the languages that are scored by their words, C shares the table of C++
+ * and is told apart by the hints. A tie goes to the earlier language. */
+static const Language wordLanguages[] = {
+    QSourceLexer::CodeCpp,
+    QSourceLexer::CodeJs,
+    QSourceLexer::CodePython,
+    QSourceLexer::CodeJava,
+    QSourceLexer::CodeCSharp,
+    QSourceLexer::CodeGo,
+    QSourceLexer::CodeRust,
+    QSourceLexer::CodePHP,
+    QSourceLexer::CodeBash,
+    QSourceLexer::CodeTypeScript,
+    QSourceLexer::CodeQML,
+    QSourceLexer::CodeV,
+    QSourceLexer::CodeSQL,
+    QSourceLexer::CodeCSS
+};
+static const int wordLanguageCount = sizeof(wordLanguages) / sizeof(wordLanguages[0]);
+
+//what a word known to a single language scores, it is split between the
+//languages that know it. Library names are often used as plain names
+//too, e.g read or list, and score half.
+static const int keywordScore = 8;
+static const int builtInScore = 4;
+//words known to more languages than this say nothing, e.g if or return
+static const int maxSharedBy = 4;
+//what a line that starts with a key and doesn't end like code scores for yaml
+static const int keyLineScore = 6;
+//what a line like [section] scores for ini
+static const int sectionScore = 8;
+
+/* a piece of text that is typical for a language */
+struct Hint {
+    template <int N>
+    constexpr Hint(const char (&hint)[N], Language hintLanguage, int hintScore,
+                   bool hintLineStart = false)
+        : text(hint),
+          length(N - 1),
+          language(hintLanguage),
+          score(hintScore),
+          lineStart(hintLineStart)
+    {
+    }
+
+    const char *text;
+    int length;
+    Language language;
+    int score;
+    //only counted as the first thing on a line
+    bool lineStart;
+};
+
+/* sorted by the first character, which is all the index below needs */
+static constexpr Hint hints[] = {
+    {"!important", QSourceLexer::CodeCSS, 8},
+    {"#[", QSourceLexer::CodeRust, 8, true},
+    {"# ", QSourceLexer::CodeMarkdown, 4, true},
+    {"## ", QSourceLexer::CodeMarkdown, 8, true},
+    {"#define", QSourceLexer::CodeCpp, 6, true},
+    {"#define", QSourceLexer::CodeC, 6, true},
+    {"#include", QSourceLexer::CodeCpp, 10, true},
+    {"#include", QSourceLexer::CodeC, 10, true},
+    {"#region", QSourceLexer::CodeCSharp, 10, true},
+    {"$(", QSourceLexer::CodeBash, 6},
+    {"$\"", QSourceLexer::CodeCSharp, 10},
+    {"$('", QSourceLexer::CodeJs, 8},
+    {"$(this", QSourceLexer::CodeJs, 8},
+    {"$this->", QSourceLexer::CodePHP, 12},
+    {"&mut", QSourceLexer::CodeRust, 10},
+    {"&self", QSourceLexer::CodeRust, 12},
+    {"($", QSourceLexer::CodePHP, 6},
+    {"(mut ", QSourceLexer::CodeV, 8},
+    {"**", QSourceLexer::CodeMarkdown, 3},
+    {"* ", QSourceLexer::CodeMarkdown, 3, true},
+    {"- ", QSourceLexer::CodeMarkdown, 4, true},
+    {"- ", QSourceLexer::CodeYAML, 4, true},
+    {"---", QSourceLexer::CodeYAML, 6, true},
+    {"--", QSourceLexer::CodeSQL, 4, true},
+    {"->", QSourceLexer::CodeCpp, 2},
+    {"->", QSourceLexer::CodeC, 2},
+    {"->", QSourceLexer::CodePHP, 3},
+    {"->", QSourceLexer::CodeRust, 2},
+    {".h>", QSourceLexer::CodeC, 4},
+    {".=", QSourceLexer::CodePHP, 8},
+    {"1. ", QSourceLexer::CodeMarkdown, 4, true},
+    {"::", QSourceLexer::CodeCpp, 6},
+    {"::", QSourceLexer::CodeRust, 4},
+    {":=", QSourceLexer::CodeGo, 8},
+    {":=", QSourceLexer::CodeV, 10},
+    {": number", QSourceLexer::CodeTypeScript, 10},
+    {": string", QSourceLexer::CodeTypeScript, 10},
+    {": boolean", QSourceLexer::CodeTypeScript, 10},
+    {"; ", QSourceLexer::CodeINI, 4, true},
+    {"</", QSourceLexer::CodeXML, 6},
+    {"<-", QSourceLexer::CodeGo, 4},
+    {"<?php", QSourceLexer::CodePHP, 30},
+    {"<>(", QSourceLexer::CodeJava, 10},
+    {"===", QSourceLexer::CodeJs, 4},
+    {"===", QSourceLexer::CodeTypeScript, 4},
+    {"=>", QSourceLexer::CodeJs, 4},
+    {"=>", QSourceLexer::CodeTypeScript, 4},
+    {"=>", QSourceLexer::CodeCSharp, 2},
+    {"> ", QSourceLexer::CodeMarkdown, 4, true},
+    {"@Override", QSourceLexer::CodeJava, 12},
+    {"@", QSourceLexer::CodeJava, 6, true},
+    {"Console.", QSourceLexer::CodeCSharp, 12},
+    {"List<", QSourceLexer::CodeJava, 4},
+    {"List<", QSourceLexer::CodeCSharp, 4},
+    {"String[]", QSourceLexer::CodeJava, 10},
+    {"System.out", QSourceLexer::CodeJava, 12},
+    {"Task<", QSourceLexer::CodeCSharp, 10},
+    {"](", QSourceLexer::CodeMarkdown, 8},
+    {"```", QSourceLexer::CodeMarkdown, 16, true},
+    {"anchors.", QSourceLexer::CodeQML, 10},
+    {"console.", QSourceLexer::CodeJs, 8},
+    {"create table", QSourceLexer::CodeSQL, 12, true},
+    {"def ", QSourceLexer::CodePython, 12, true},
+    {"delete from", QSourceLexer::CodeSQL, 12, true},
+    {"document.", QSourceLexer::CodeJs, 6},
+    {"elif ", QSourceLexer::CodePython, 8, true},
+    {"extends ", QSourceLexer::CodeJava, 4},
+    {"fmt.", QSourceLexer::CodeGo, 10},
+    {"fn ", QSourceLexer::CodeRust, 6},
+    {"fn ", QSourceLexer::CodeV, 6},
+    {"function(", QSourceLexer::CodeJs, 4},
+    {"function (", QSourceLexer::CodeJs, 4},
+    {"func ", QSourceLexer::CodeGo, 12, true},
+    {"get;", QSourceLexer::CodeCSharp, 12},
+    {"import Qt", QSourceLexer::CodeQML, 30, true},
+    {"import java", QSourceLexer::CodeJava, 20, true},
+    {"insert into", QSourceLexer::CodeSQL, 12, true},
+    {"impl ", QSourceLexer::CodeRust, 10, true},
+    {"implements ", QSourceLexer::CodeJava, 6},
+    {"interface ", QSourceLexer::CodeTypeScript, 6},
+    {"interface {", QSourceLexer::CodeGo, 10},
+    {"let mut ", QSourceLexer::CodeRust, 12},
+    {"malloc(", QSourceLexer::CodeC, 8},
+    {"module ", QSourceLexer::CodeV, 16, true},
+    {"mut:", QSourceLexer::CodeV, 12, true},
+    {"namespace ", QSourceLexer::CodeCpp, 6, true},
+    {"namespace ", QSourceLexer::CodeCSharp, 6, true},
+    {"nullptr", QSourceLexer::CodeCpp, 8},
+    {"package ", QSourceLexer::CodeGo, 12, true},
+    {"package ", QSourceLexer::CodeJava, 10, true},
+    {"print(", QSourceLexer::CodePython, 4},
+    {"printf(", QSourceLexer::CodeC, 4},
+    {"private:", QSourceLexer::CodeCpp, 10, true},
+    {"property ", QSourceLexer::CodeQML, 8, true},
+    {"public:", QSourceLexer::CodeCpp, 10, true},
+    {"select ", QSourceLexer::CodeSQL, 8, true},
+    {"self.", QSourceLexer::CodePython, 8},
+    {"size_t", QSourceLexer::CodeCpp, 6},
+    {"size_t", QSourceLexer::CodeC, 6},
+    {"std::", QSourceLexer::CodeCpp, 12},
+    {"template", QSourceLexer::CodeCpp, 6},
+    {"use ", QSourceLexer::CodeRust, 8, true},
+    {"using System", QSourceLexer::CodeCSharp, 20, true},
+    {"using namespace", QSourceLexer::CodeCpp, 12, true},
+    {"window.", QSourceLexer::CodeJs, 6}
+};
+
+/* the range of hints starting with a character, like the index of
+ * KeywordTable */
+struct HintIndex {
+    static constexpr int firstChars = 128;
+
+    constexpr HintIndex()
+    {
+        const int count = sizeof(hints) / sizeof(hints[0]);
+        for (int c = 0, i = 0; c <= firstChars; ++c) {
+            while (i < count && static_cast<unsigned char>(hints[i].text[0]) < c) ++i;
+            first[c] = static_cast<quint8>(i);
+        }
+    }
+
+    static constexpr bool isSorted() {
+        const int count = sizeof(hints) / sizeof(hints[0]);
+        for (int i = 1; i < count; ++i) {
+            if (hints[i - 1].text[0] > hints[i].text[0]) return false;
+        }
+        return true;
+    }
+
+    quint8 first[firstChars + 1] = {};
+};
+static_assert(HintIndex::isSorted(), "the hints aren't sorted by their first character");
+static constexpr HintIndex hintIndex;
+
+static inline bool startsWith(QStringView text, int i, const Hint &hint) {
+    if (text.size() - i < hint.length) return false;
+    for (int j = 1; j < hint.length; ++j) {
+        if (text.at(i + j).unicode() != static_cast<unsigned char>(hint.text[j])) return false;
+    }
+    return true;
+}
+
+/* an ini section, e.g [General] or [core.editor] */
+static bool isSection(QStringView line) {
+    if (line.size() < 3 || line.at(0) != QLatin1Char('[') || line.back() != QLatin1Char(']') ||
+        !isWordStart(line.at(1).unicode()))
+        return false;
+    for (int i = 2; i < line.size() - 1; ++i) {
+        const ushort c = line.at(i).unicode();
+        if (!isWordChar(c) && c != '.' && c != '-' && c != ' ') return false;
+    }
+    return true;
+}
+
+/* the interpreters of a shebang that aren't named like a language */
+static const struct {
+    const char *name;
+    Language language;
+} interpreters[] = {
+    {"ash", QSourceLexer::CodeBash},
+    {"dash", QSourceLexer::CodeBash},
+    {"deno", QSourceLexer::CodeTypeScript},
+    {"ksh", QSourceLexer::CodeBash},
+    {"node", QSourceLexer::CodeJs},
+    {"nodejs", QSourceLexer::CodeJs},
+    {"ts-node", QSourceLexer::CodeTypeScript},
+    {"zsh", QSourceLexer::CodeBash}
+};
+
+/**
+ * @brief Reads the interpreter of a shebang, e.g #!/usr/bin/env python3
+ * @return the language or -1 if the interpreter is unknown
+ */
+static int shebangLanguage(QStringView line) {
+    //the words after #!, the last path component of each
+    QStringView words[2];
+    int count = 0;
+    int i = 2;
+    while (i < line.size() && count < 2) {
+        while (i < line.size() && line.at(i).isSpace()) ++i;
+        const int start = i;
+        while (i < line.size() && !line.at(i).isSpace()) ++i;
+        if (i == start) break;
+        QStringView word = line.mid(start, i - start);
+        word = word.mid(word.lastIndexOf(QLatin1Char('/')) + 1);
+        words[count++] = word;
+    }
+    if (count == 0) return -1;
+
+    QStringView name = words[0];
+    if (name == QLatin1String("env") && count > 1) name = words[1];
+    //python3, python3.8
+    while (!name.isEmpty() && (name.back().isDigit() || name.back() == QLatin1Char('.')))
+        name.chop(1);
+
+    for (const auto &entry : interpreters) {
+        if (name == QLatin1String(entry.name)) return entry.language;
+    }
+    return QSourceLexer::languageForName(name);
+}
+
+/**
+ * @brief Looks at the start of the text for something that gives the
+ * language away
+ * @return the language or -1
+ */
+static int signatureLanguage(QStringView text) {
+    int i = 0;
+    //a byte order mark
+    if (!text.isEmpty() && text.at(0).unicode() == 0xFEFF) ++i;
+    while (i < text.size() && text.at(i).isSpace()) ++i;
+    if (i == text.size()) return -1;
+
+    int end = text.indexOf(QLatin1Char('\n'), i);
+    if (end < 0) end = text.size();
+    const QStringView line = text.mid(i, end - i).trimmed();
+
+    if (line.startsWith(QLatin1String("#!/")) || line.startsWith(QLatin1String("#! /"))) {
+        const int language = shebangLanguage(line);
+        if (language >= 0) return language;
+        //e.g #!/usr/local/bin/php-cgi, the script opens php right after it
+        return text.mid(end).trimmed().startsWith(QLatin1String("<?php")) ? QSourceLexer::CodePHP : -1;
+    }
+    //only at the start, a <?php further down is left to the scores
+    if (line.startsWith(QLatin1String("<?php"))) return QSourceLexer::CodePHP;
+
+    const QChar first = line.at(0);
+    if (first == QLatin1Char('<')) {
+        const QChar next = line.size() > 1 ? line.at(1) : QChar();
+        if (next == QLatin1Char('?') || next == QLatin1Char('!') || next.isLetter())
+            return QSourceLexer::CodeXML;
+        return -1;
+    }
+
+    if (isSection(line)) return QSourceLexer::CodeINI;
+
+    //a json object or array, the first thing inside decides
+    if (first == QLatin1Char('{') || first == QLatin1Char('[')) {
+        int j = i + 1;
+        while (j < text.size() && text.at(j).isSpace()) ++j;
+        if (j == text.size()) return QSourceLexer::CodeJSON;
+        const QChar c = text.at(j);
+        if (c == QLatin1Char('"') || c == QLatin1Char('}') || c == QLatin1Char(']'))
+            return QSourceLexer::CodeJSON;
+        if (first == QLatin1Char('[') &&
+            (c == QLatin1Char('{') || c == QLatin1Char('[') || c == QLatin1Char('-') || c.isDigit()))
+            return QSourceLexer::CodeJSON;
+        return -1;
+    }
+
+    if (line == QLatin1String("---")) return QSourceLexer::CodeYAML;
+    return -1;
+}
+
+/**
+ * @brief Recognizes a text only by a signature at its start, e.g a shebang,
+ * <?php or a JSON object. Prose and code without one aren't guessed, e.g a
+ * LICENSE or a Makefile.
+ * @param text the text or its first sampleSize characters
+ * @param fallback the language when there is no signature
+ */
+Language QSourceDetector::detectSignature(QStringView text, Language fallback)
+{
+    const int signature = signatureLanguage(text.left(sampleSize));
+    return signature < 0 ? fallback : static_cast<Language>(signature);
+}
+
+/**
+ * @brief Guesses the language of a text
+ * @details A signature at the start of the text wins, otherwise the words
+ * and hints of the first sampleSize characters are scored. A word scores for
+ * every language whose keyword table has it, less the more languages share
+ * it, a hint scores for its language every time it is found. C is C++
+ * without any of the hints of C++.
+ * @param text the text or its first sampleSize characters
+ * @param fallback the language when nothing is recognized
+ */
+Language QSourceDetector::detect(QStringView text, Language fallback)
+{
+    const QStringView sample = text.left(sampleSize);
+
+    const int signature = signatureLanguage(sample);
+    if (signature >= 0) return static_cast<Language>(signature);
+
+    const KeywordTable *tables[wordLanguageCount];
+    for (int l = 0; l < wordLanguageCount; ++l)
+        tables[l] = QSourceLexer::keywordTable(wordLanguages[l]);
+
+    int scores[slotCount] = {};
+    bool lineStart = true;
+    //the line starts with a key, e.g name: value
+    bool keyLine = false;
+    //the first and last character of the line that isn't a space
+    int lineBegin = 0;
+    int lineEnd = -1;
+    const int size = sample.size();
+    for (int i = 0; i <= size;) {
+        const ushort c = i < size ? sample.at(i).unicode() : ushort('\n');
+        if (c == '\n') {
+            if (lineEnd >= 0) {
+                //a yaml mapping, unless the line ends like css or code
+                const QChar last = sample.at(lineEnd);
+                if (keyLine && last != QLatin1Char(';') && last != QLatin1Char('{') &&
+                    last != QLatin1Char(',') && last != QLatin1Char('('))
+                    scores[slot(QSourceLexer::CodeYAML)] += keyLineScore;
+                if (isSection(sample.mid(lineBegin, lineEnd - lineBegin + 1)))
+                    scores[slot(QSourceLexer::CodeINI)] += sectionScore;
+            }
+            lineStart = true;
+            keyLine = false;
+            lineEnd = -1;
+            ++i;
+            continue;
+        }
+        if (c == ' ' || c == '\t' || c == '\r') {
+            ++i;
+            continue;
+        }
+
+        if (c < HintIndex::firstChars) {
+            for (int h = hintIndex.first[c]; h < hintIndex.first[c + 1]; ++h) {
+                const Hint &hint = hints[h];
+                if ((!hint.lineStart || lineStart) && startsWith(sample, i, hint))
+                    scores[slot(hint.language)] += hint.score;
+            }
+        }
+        const bool firstOnLine = lineStart;
+        if (lineStart) lineBegin = i;
+        lineStart = false;
+
+        if (!isWordStart(c)) {
+            lineEnd = i;
+            ++i;
+            continue;
+        }
+
+        int end = i + 1;
+        while (end < size && isWordChar(sample.at(end).unicode())) ++end;
+        const QChar *word = sample.data() + i;
+        const int length = end - i;
+        const QChar next = end < size ? sample.at(end) : QChar();
+        lineEnd = end - 1;
+
+        //a member, e.g item.value, is a name whatever the tables say
+        const bool member = (i > 0 && sample.at(i - 1) == QLatin1Char('.')) ||
+                            next == QLatin1Char('.');
+        int found[wordLanguageCount];
+        int weights[wordLanguageCount];
+        int count = 0;
+        bool keyword = false;
+        for (int l = 0; l < wordLanguageCount && !member; ++l) {
+            const Language language = wordLanguages[l];
+            //the macros of rust end in !, e.g println!
+            const bool macro = language == QSourceLexer::CodeRust && next == QLatin1Char('!');
+            const KeywordTable::Category category = tables[l]->lookup(word, macro ? length + 1 : length);
+            if (category == KeywordTable::None) continue;
+            //most css words are also common names, only properties count
+            if (language == QSourceLexer::CodeCSS && next != QLatin1Char(':') &&
+                next != QLatin1Char('-') && (i == 0 || sample.at(i - 1) != QLatin1Char('-')))
+                continue;
+            if (language != QSourceLexer::CodeCSS) keyword = true;
+            weights[count] = category == KeywordTable::BuiltIn || category == KeywordTable::Other
+                                 ? builtInScore : keywordScore;
+            found[count++] = l;
+        }
+        if (count > 0 && count <= maxSharedBy) {
+            for (int f = 0; f < count; ++f) {
+                const Language language = wordLanguages[found[f]];
+                const int score = weights[f] / count;
+                scores[slot(language)] += score;
+                if (language == QSourceLexer::CodeCpp)
+                    scores[slot(QSourceLexer::CodeC)] += score;
+            }
+        }
+
+        //else: or public: are no keys
+        if (firstOnLine && !keyword && next == QLatin1Char(':') &&
+            (end + 1 == size || sample.at(end + 1) != QLatin1Char(':')))
+            keyLine = true;
+        i = end;
+    }
+
+    int best = -1;
+    int bestScore = 0;
+    for (int l = 0; l < wordLanguageCount; ++l) {
+        if (scores[slot(wordLanguages[l])] > bestScore) {
+            best = wordLanguages[l];
+            bestScore = scores[slot(best)];
+        }
+    }
+    //the languages scored by their hints alone
+    for (const Language language : {QSourceLexer::CodeC, QSourceLexer::CodeMarkdown,
+                                    QSourceLexer::CodeYAML, QSourceLexer::CodeINI,
+                                    QSourceLexer::CodeXML}) {
+        if (scores[slot(language)] > bestScore) {
+            best = language;
+            bestScore = scores[slot(language)];
+        }
+    }
+    //C++ without anything that only C++ has is C
+    if (best == QSourceLexer::CodeCpp && scores[slot(QSourceLexer::CodeC)] >= bestScore)
+        best = QSourceLexer::CodeC;
+    return best < 0 ? fallback : static_cast<Language>(best);
+}
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2019 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 3 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ */
+#ifndef QSOURCEDETECTOR_H
+#define QSOURCEDETECTOR_H
+
+#include "qsourcelexer.h"
+
+/**
+ * @brief Guesses the language of a text from its content
+ * @details Only the first sampleSize characters are looked at. A few
+ * signatures at the start of the text (a shebang, <?php, <?xml, a JSON
+ * object) decide right away, otherwise every word of the sample is looked up
+ * in the keyword tables of the lexer and a handful of punctuation hints
+ * (e.g ::, := or =>) are counted. It is a single pass over the sample that
+ * allocates nothing, so it can run on every file that is opened.
+ */
+class QSourceDetector
+{
+public:
+    //how much of the text is looked at
+    static constexpr int sampleSize = 4096;
+
+    static QSourceLexer::Language detect(QStringView text,
+                                         QSourceLexer::Language fallback = QSourceLexer::CodeCpp);
+    static QSourceLexer::Language detectSignature(QStringView text, QSourceLexer::Language fallback);
+};
+
+#endif // QSOURCEDETECTOR_H
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2019 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 3 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ */
+#include "qsourcefilelexer.h"
+
+#include <QFile>
+#include <QString>
+
+#include <cstring>
+#include <limits>
+
+/* the longest line that still fits into a QString */
+static const qint64 maxLineSize = std::numeric_limits<int>::max() / 2;
+
+/**
+ * @brief Decodes UTF-8, invalid bytes become U+FFFD
+ * @param out has room for @p size characters, UTF-8 never takes fewer
+ * bytes than UTF-16 takes characters
+ * @return the number of characters written
+ */
+static int decodeUtf8(const uchar *data, int size, QChar *out) {
+    int n = 0;
+    int i = 0;
+    while (i < size) {
+        //runs of ASCII are the common case
+        while (i < size && data[i] < 0x80) out[n++] = QChar(data[i++]);
+        if (i == size) break;
+
+        const uchar lead = data[i];
+        int extra;
+        uint code;
+        uint minimum;
+        if (lead >= 0xC2 && lead <= 0xDF) {
+            extra = 1;
+            code = lead & 0x1F;
+            minimum = 0x80;
+        } else if (lead >= 0xE0 && lead <= 0xEF) {
+            extra = 2;
+            code = lead & 0x0F;
+            minimum = 0x800;
+        } else if (lead >= 0xF0 && lead <= 0xF4) {
+            extra = 3;
+            code = lead & 0x07;
+            minimum = 0x10000;
+        } else {
+            out[n++] = QChar(QChar::ReplacementCharacter);
+            ++i;
+            continue;
+        }
+
+        int j = 1;
+        for (; j <= extra && i + j < size && (data[i + j] & 0xC0) == 0x80; ++j)
+            code = (code << 6) | (data[i + j] & 0x3F);
+        //cut short, overlong, a surrogate or out of range
+        if (j <= extra || code < minimum || code > 0x10FFFF || (code >= 0xD800 && code <= 0xDFFF)) {
+            out[n++] = QChar(QChar::ReplacementCharacter);
+            ++i;
+            continue;
+        }
+
+        if (code >= 0x10000) {
+            out[n++] = QChar(QChar::highSurrogate(code));
+            out[n++] = QChar(QChar::lowSurrogate(code));
+        } else {
+            out[n++] = QChar(static_cast<ushort>(code));
+        }
+        i += extra + 1;
+    }
+    return n;
+}
+
+/**
+ * @brief Lexes one line after the other and hands them to the sink
+ * @details The text buffer and the tokens are reused for every line, they
+ * only grow to the size of the longest line.
+ */
+class LineLexer
+{
+public:
+    LineLexer(int language, const QSourceFileLexer::Sink &sink)
+        : _state(language),
+          _sink(sink)
+    {
+    }
+
+    bool lex(const char *data, qint64 size);
+    qint64 lexLines(const char *data, qint64 size, bool last);
+
+private:
+    int _state;
+    qint64 _line = 0;
+    QString _text;
+    QVector<QSourceLexer::Token> _tokens;
+    const QSourceFileLexer::Sink &_sink;
+};
+
+/**
+ * @brief Lexes a line without its '\n'
+ * @return false if the line is too long for a QString
+ */
+bool LineLexer::lex(const char *data, qint64 size)
+{
+    if (size > 0 && data[size - 1] == '\r') --size;
+    //a byte order mark
+    if (_line == 0 && size >= 3 && std::memcmp(data, "\xEF\xBB\xBF", 3) == 0) {
+        data += 3;
+        size -= 3;
+    }
+    if (size > maxLineSize) return false;
+
+    if (_text.size() < size) _text.resize(int(size));
+    const int length = decodeUtf8(reinterpret_cast<const uchar *>(data), int(size), _text.data());
+    const QStringView text(_text.constData(), length);
+
+    _state = QSourceLexer::lex(text, _state, _tokens);
+    _sink(_line, text, _tokens);
+    ++_line;
+    return true;
+}
+
+/**
+ * @brief Lexes the lines of a window of the file
+ * @param last whether the window reaches the end of the file, the text
+ * after the last '\n' is then the last line
+ * @return how much of the window was lexed, the rest is the start of a line
+ * that goes on in the next window, or -1 if a line is too long
+ */
+qint64 LineLexer::lexLines(const char *data, qint64 size, bool last)
+{
+    qint64 pos = 0;
+    for (;;) {
+        const void *newline = std::memchr(data + pos, '\n', size_t(size - pos));
+        if (!newline) break;
+        const qint64 end = static_cast<const char *>(newline) - data;
+        if (!lex(data + pos, end - pos)) return -1;
+        pos = end + 1;
+    }
+    if (!last) return pos;
+    if (!lex(data + pos, size - pos)) return -1;
+    return size;
+}
+
+/* reads what can't be mapped, a window at a time */
+static bool lexDevice(QIODevice &device, LineLexer &lexer) {
+    QByteArray buffer;
+    for (;;) {
+        //what is kept is the start of a line, the line is too long once it
+        //is longer than a QString can hold
+        const int kept = buffer.size();
+        if (kept > maxLineSize) return false;
+        buffer.resize(kept + int(QSourceFileLexer::windowSize));
+        const qint64 read = device.read(buffer.data() + kept, QSourceFileLexer::windowSize);
+        if (read < 0) return false;
+        buffer.resize(kept + int(read));
+
+        const bool last = read == 0;
+        const qint64 used = lexer.lexLines(buffer.constData(), buffer.size(), last);
+        if (used < 0) return false;
+        if (last) return true;
+        buffer.remove(0, int(used));
+    }
+}
+
+/**
+ * @brief Lexes the file at @p path line by line
+ * @details Lines end at '\n', a '\r' before it is dropped. Like in a
+ * QTextDocument, a file that ends with '\n' ends with an empty line, and an
+ * empty file has a single empty line.
+ * @param language the language the first line starts in
+ * @param sink gets every line with its number, starting at 0, and tokens
+ * @return false if the file can't be read or has a line longer than a
+ * QString can hold
+ */
+bool QSourceFileLexer::lexFile(const QString &path, int language, const Sink &sink)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) return false;
+
+    LineLexer lexer(language, sink);
+    if (file.isSequential()) return lexDevice(file, lexer);
+
+    const qint64 size = file.size();
+    if (size == 0) return lexer.lex("", 0);
+
+    qint64 offset = 0;
+    qint64 window = windowSize;
+    while (offset < size) {
+        const qint64 length = qMin(window, size - offset);
+        uchar *map = file.map(offset, length);
+        if (!map) {
+            //some file systems can't be mapped
+            if (!file.seek(offset)) return false;
+            return lexDevice(file, lexer);
+        }
+
+        const bool last = offset + length == size;
+        const qint64 used = lexer.lexLines(reinterpret_cast<const char *>(map), length, last);
+        //unmapping drops the pages that were read from the resident memory
+        file.unmap(map);
+        if (used < 0) return false;
+
+        //a line longer than the window, map more of it unless it is too long
+        //for a QString anyway
+        if (used == 0 && window > maxLineSize) return false;
+        window = used == 0 ? window * 2 : windowSize;
+        offset += used;
+    }
+    return true;
+}
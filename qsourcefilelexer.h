@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2019 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 3 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ */
+#ifndef QSOURCEFILELEXER_H
+#define QSOURCEFILELEXER_H
+
+#include <functional>
+
+#include "qsourcelexer.h"
+
+class QString;
+
+/**
+ * @brief Lexes a whole file without loading it
+ * @details The file is mapped a window at a time and split into lines
+ * right in the mapping. Each line is decoded from UTF-8 into a buffer that
+ * is reused for every line, lexed, and handed to a sink together with its
+ * tokens. Only the current window and the longest line so far are held in
+ * memory, however big the file is. Files that can't be mapped, e.g pipes,
+ * are read a window at a time instead.
+ */
+class QSourceFileLexer
+{
+public:
+    //called for every line, the text and the tokens are only valid during the call
+    using Sink = std::function<void(qint64 line, QStringView text,
+                                    const QVector<QSourceLexer::Token> &tokens)>;
+
+    //how much of the file is mapped or read at a time
+    static constexpr qint64 windowSize = 16 * 1024 * 1024;
+
+    static bool lexFile(const QString &path, int language, const Sink &sink);
+};
+
+#endif // QSOURCEFILELEXER_H
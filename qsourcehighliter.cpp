@@ -12,17 +12,46 @@
  *
  */
 #include "qsourcehighliter.h"
-#include "languagedata.h"
+#include "qsourceparallellexer.h"
 
 #include <QDebug>
+#include <QElapsedTimer>
 #include <QTextDocument>
+#include <QTimer>
+
+/**
+ * @brief Keeps the tokens of a block together with the text and the state
+ * they were lexed from, so an unchanged block is never lexed twice
+ */
+class QSourceHighliter::BlockData : public QTextBlockUserData
+{
+public:
+    LexedBlock lexed;
+    //lexed by lexAhead() and not counted in the statistics yet
+    bool lexedAhead = false;
+};
+
+/* number of blocks the worker lexes before handing them to the GUI thread */
+static const int batchSize = 512;
+
+/* fewer new blocks than this aren't worth the threads in Parallel mode */
+static const int parallelRunSize = 1024;
 
 QSourceHighliter::QSourceHighliter(QTextDocument *doc)
-    : QSyntaxHighlighter(doc)
+    : QSyntaxHighlighter(doc),
+      _language(CodeCpp)
 {
+    _pool.setMaxThreadCount(1);
     initFormats();
 }
 
+QSourceHighliter::~QSourceHighliter()
+{
+    //the worker uses this object, let it finish before anything is destroyed
+    _generation.ref();
+    _pool.waitForDone();
+}
+
 void QSourceHighliter::initFormats() {
     /****************************************
      * Formats for syntax highlighting
@@ -30,42 +59,54 @@ void QSourceHighliter::initFormats() {
 
     QTextCharFormat format = QTextCharFormat();
     format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
-    _formats[CodeBlock] = format;
+    _formats[QSourceLexer::Block] = format;
 
     format = QTextCharFormat();
     format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
     format.setForeground(QColor("#F92672"));
-    _formats[CodeKeyWord] = format;
+    _formats[QSourceLexer::KeyWord] = format;
 
     format = QTextCharFormat();
     format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
     format.setForeground(QColor("#a39b4e"));
-    _formats[CodeString] = format;
+    _formats[QSourceLexer::String] = format;
 
     format = QTextCharFormat();
     format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
     format.setForeground(QColor("#75715E"));
-    _formats[CodeComment] = format;
+    _formats[QSourceLexer::Comment] = format;
 
     format = QTextCharFormat();
     format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
     format.setForeground(QColor("#54aebf"));
-    _formats[CodeType] = format;
+    _formats[QSourceLexer::Type] = format;
 
     format = QTextCharFormat();
     format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
     format.setForeground(QColor("#db8744"));
-    _formats[CodeOther] = format;
+    _formats[QSourceLexer::Other] = format;
 
     format = QTextCharFormat();
     format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
     format.setForeground(QColor("#AE81FF"));
-    _formats[CodeNumLiteral] = format;
+    _formats[QSourceLexer::NumLiteral] = format;
 
     format = QTextCharFormat();
     format.setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
     format.setForeground(QColor("#018a0f"));
-    _formats[CodeBuiltIn] = format;
+    _formats[QSourceLexer::BuiltIn] = format;
+
+    resolveFormats();
+}
+
+/**
+ * @brief Fills in the formats that are derived from others, links are
+ * underlined strings and color values start out as plain code
+ */
+void QSourceHighliter::resolveFormats() {
+    _formats[QSourceLexer::Link] = _formats[QSourceLexer::String];
+    _formats[QSourceLexer::Link].setUnderlineStyle(QTextCharFormat::SingleUnderline);
+    _formats[QSourceLexer::Color] = _formats[QSourceLexer::Block];
 }
 
 void QSourceHighliter::setCurrentLanguage(Language language) {
@@ -77,600 +118,486 @@ QSourceHighliter::Language QSourceHighliter::currentLanguage() {
     return _language;
 }
 
-void QSourceHighliter::highlightBlock(const QString &text)
-{
-    if (currentBlock() == document()->firstBlock()) {
-        setCurrentBlockState(_language);
-    } else {
-        previousBlockState() == _language ?
-                    setCurrentBlockState(_language) :
-                    setCurrentBlockState(_language + 1);
-    }
-    highlightSyntax(text);
+/**
+ * @brief The format tokens of a kind are painted with
+ * @details Color tokens are painted with the color they name, for them this
+ * is the code block format.
+ */
+QTextCharFormat QSourceHighliter::tokenFormat(QSourceLexer::TokenKind kind) const {
+    if (kind >= formatCount) return QTextCharFormat();
+    return _formats[kind];
+}
+
+QSourceHighliter::Statistics &QSourceHighliter::Statistics::operator+=(const Statistics &other) {
+    blocks += other.blocks;
+    blocksLexed += other.blocksLexed;
+    blocksReused += other.blocksReused;
+    blocksDeferred += other.blocksDeferred;
+    charactersLexed += other.charactersLexed;
+    keywordLookups += other.keywordLookups;
+    formatCalls += other.formatCalls;
+    nsecs += other.nsecs;
+    return *this;
 }
 
 /**
- * @brief Does the code syntax highlighting
- * @param text
+ * @brief Turns on counting what highlighting costs
+ * @details Off by default, when off highlightBlock() doesn't do any extra
+ * work. The numbers only cover highlightBlock() itself, not the layout
+ * QTextDocument does afterwards, so the two can be told apart.
  */
-void QSourceHighliter::highlightSyntax(const QString &text)
-{
-    if (text.isEmpty()) return;
-
-    const auto textLen = text.length();
-
-    QChar comment;
-    bool isCSS = false;
-    bool isYAML = false;
-
-    QMultiHash<char, QLatin1String> keywords{};
-    QMultiHash<char, QLatin1String> others{};
-    QMultiHash<char, QLatin1String> types{};
-    QMultiHash<char, QLatin1String> builtin{};
-    QMultiHash<char, QLatin1String> literals{};
-
-    QList<QLatin1String> wordList;
-
-    switch (currentBlockState()) {
-        case CodeCpp :
-        case CodeCppComment :
-            loadCppData(types, keywords, builtin, literals, others);
-            break;
-        case CodeJs :
-        case CodeJsComment :
-            loadJSData(types, keywords, builtin, literals, others);
-            break;
-        case CodeC :
-        case CodeCComment :
-            loadCppData(types, keywords, builtin, literals, others);
-            break;
-        case CodeBash :
-            loadShellData(types, keywords, builtin, literals, others);
-            comment = QLatin1Char('#');
-            break;
-        case CodePHP :
-        case CodePHPComment :
-            loadPHPData(types, keywords, builtin, literals, others);
-            break;
-        case CodeQML :
-        case CodeQMLComment :
-            loadQMLData(types, keywords, builtin, literals, others);
-            break;
-        case CodePython :
-            loadPythonData(types, keywords, builtin, literals, others);
-            comment = QLatin1Char('#');
-            break;
-        case CodeRust :
-        case CodeRustComment :
-            loadRustData(types, keywords, builtin, literals, others);
-            break;
-        case CodeJava :
-        case CodeJavaComment :
-            loadJavaData(types, keywords, builtin, literals, others);
-            break;
-        case CodeCSharp :
-        case CodeCSharpComment :
-            loadCSharpData(types, keywords, builtin, literals, others);
-            break;
-        case CodeGo :
-        case CodeGoComment :
-            loadGoData(types, keywords, builtin, literals, others);
-            break;
-        case CodeV :
-        case CodeVComment :
-            loadVData(types, keywords, builtin, literals, others);
-            break;
-        case CodeSQL :
-            loadSQLData(types, keywords, builtin, literals, others);
-            break;
-        case CodeJSON :
-            loadJSONData(types, keywords, builtin, literals, others);
-            break;
-        case CodeXML :
-            xmlHighlighter(text);
-            return;
-        case CodeCSS :
-        case CodeCSSComment :
-            isCSS = true;
-            loadCSSData(types, keywords, builtin, literals, others);
-            break;
-        case CodeTypeScript:
-        case CodeTypeScriptComment:
-            loadTypescriptData(types, keywords, builtin, literals, others);
-            break;
-        case CodeYAML:
-            isYAML = true;
-            loadYAMLData(types, keywords, builtin, literals, others);
-            comment = QLatin1Char('#');
-            break;
-        case CodeINI:
-            comment = QLatin1Char('#');
-            break;
-    default:
-        break;
-    }
+void QSourceHighliter::setStatisticsEnabled(bool enabled) {
+    _statisticsEnabled = enabled;
+}
 
-    // keep the default code block format
-    // this statement is very slow
-    // TODO: do this formatting when necessary instead of
-    // applying it to the whole block in the beginning
-    setFormat(0, textLen, _formats[CodeBlock]);
-
-    auto applyCodeFormat = [this, &wordList](int i, const QMultiHash<char, QLatin1String> &data,
-                        const QString &text, const QTextCharFormat &fmt) -> int {
-        // check if we are at the beginning OR if this is the start of a word
-        // AND the current char is present in the data structure
-        if ( ( i == 0 || !text[i-1].isLetter()) && data.contains(text[i].toLatin1())) {
-            wordList = data.values(text[i].toLatin1());
-#if QT_VERSION >= 0x050700
-            for(const QLatin1String &word : qAsConst(wordList)) {
-#else
-            for(const QLatin1String &word : wordList) {
-#endif
-                if (word == text.midRef(i, word.size())) {
-                    //check if we are at the end of text OR if we have a complete word
-                    if ( i + word.size() == text.length() ||
-                         !text.at(i + word.size()).isLetter()) {
-                        setFormat(i, word.size(), fmt);
-                        i += word.size();
-                    }
-                }
-            }
-        }
-        return i;
-    };
-
-    const QTextCharFormat &formatType = _formats[CodeType];
-    const QTextCharFormat &formatKeyword = _formats[CodeKeyWord];
-    const QTextCharFormat &formatComment = _formats[CodeComment];
-    const QTextCharFormat &formatNumLit = _formats[CodeNumLiteral];
-    const QTextCharFormat &formatBuiltIn = _formats[CodeBuiltIn];
-    const QTextCharFormat &formatOther = _formats[CodeOther];
-
-    for (int i=0; i< textLen; ++i) {
-
-        if (currentBlockState() % 2 != 0) goto Comment;
-
-        while (i < textLen && !text[i].isLetter()) {
-            if (text[i].isSpace()) {
-                ++i;
-                //make sure we don't cross the bound
-                if (i == textLen) return;
-                if (text[i].isLetter()) break;
-                else continue;
-            }
-            //inline comment
-            if (comment.isNull() && text[i] == QLatin1Char('/')) {
-                if((i+1) < textLen){
-                    if(text[i+1] == QLatin1Char('/')) {
-                        setFormat(i, textLen, formatComment);
-                        return;
-                    } else if(text[i+1] == QLatin1Char('*')) {
-                        Comment:
-                        int next = text.indexOf(QLatin1String("*/"));
-                        if (next == -1) {
-                            //we didn't find a comment end.
-                            //Check if we are already in a comment block
-                            if (currentBlockState() % 2 == 0)
-                                setCurrentBlockState(currentBlockState() + 1);
-                            setFormat(i, textLen,  formatComment);
-                            return;
-                        } else {
-                            //we found a comment end
-                            //mark this block as code if it was previously comment
-                            //first check if the comment ended on the same line
-                            //if modulo 2 is not equal to zero, it means we are in a comment
-                            //-1 will set this block's state as language
-                            if (currentBlockState() % 2 != 0) {
-                                setCurrentBlockState(currentBlockState() - 1);
-                            }
-                            next += 2;
-                            setFormat(i, next - i,  formatComment);
-                            i = next;
-                            if (i >= textLen) return;
-                        }
-                    }
-                }
-            } else if (text[i] == comment) {
-                setFormat(i, textLen, formatComment);
-                i = textLen;
-            //integer literal
-            } else if (text[i].isNumber()) {
-               i = highlightIntegerLiterals(text, i);
-            //string literals
-            } else if (text[i] == QLatin1Char('\"')) {
-               i = highlightStringLiterals('\"', text, i);
-            }  else if (text[i] == QLatin1Char('\'')) {
-               i = highlightStringLiterals('\'', text, i);
-            }
-            if (i >= textLen) {
-                break;
-            }
-            ++i;
-        }
+bool QSourceHighliter::statisticsEnabled() const {
+    return _statisticsEnabled;
+}
 
-        int pos = i;
-
-        if (i == textLen || !text[i].isLetter()) continue;
-
-        /* Highlight Types */
-        i = applyCodeFormat(i, types, text, formatType);
-        /************************************************
-         next letter is usually a space, in that case
-         going forward is useless, so continue;
-         We can ++i here and go to the beginning of the next word
-         so that the next formatter can check for formatting but this will
-         cause problems in case the next word is also of 'Type' or the current
-         type(keyword/builtin). We can work around it and reset the value of i
-         in the beginning of the loop to the word's first letter but I am not
-         sure about its efficiency yet.
-         ************************************************/
-        if (i == textLen || !text[i].isLetter()) continue;
-
-        /* Highlight Keywords */
-        i = applyCodeFormat(i, keywords, text, formatKeyword);
-        if (i == textLen || !text[i].isLetter()) continue;
-
-        /* Highlight Literals (true/false/NULL,nullptr) */
-        i = applyCodeFormat(i, literals, text, formatNumLit);
-        if (i == textLen || !text[i].isLetter()) continue;
-
-        /* Highlight Builtin library stuff */
-        i = applyCodeFormat(i, builtin, text, formatBuiltIn);
-        if (i == textLen || !text[i].isLetter()) continue;
-
-        /* Highlight other stuff (preprocessor etc.) */
-        if (( i == 0 || !text[i-1].isLetter()) && others.contains(text[i].toLatin1())) {
-            wordList = others.values(text[i].toLatin1());
-#if QT_VERSION >= 0x050700
-            for(const QLatin1String &word : qAsConst(wordList)) {
-#else
-            for(const QLatin1String &word : wordList) {
-#endif
-                if (word == text.midRef(i, word.size()).toLatin1()) {
-                    if ( i + word.size() == textLen ||
-                         !text.at(i + word.size()).isLetter()) {
-                        currentBlockState() == CodeCpp ?
-                        setFormat(i-1, word.size()+1, formatOther) :
-                                    setFormat(i, word.size(), formatOther);
-                        i += word.size();
-                    }
-                }
-            }
-        }
+/**
+ * @brief The totals of a language since statistics were enabled or reset
+ * @details Blocks are counted under the language they start in, so the code
+ * blocks of a markdown document count for their own language.
+ */
+QSourceHighliter::Statistics QSourceHighliter::statistics(Language language) const {
+    return _statistics.value(language);
+}
 
-        //we were unable to find any match, lets skip this word
-        if (pos == i) {
-            int cnt = i;
-            while (cnt < textLen) {
-                if (!text[cnt].isLetter()) break;
-                ++cnt;
-            }
-            i = cnt;
-        }
-    }
+void QSourceHighliter::resetStatistics() {
+    _statistics.clear();
+}
 
-    if (isCSS) cssHighlighter(text);
-    if (isYAML) ymlHighlighter(text);
+/**
+ * @brief Sets a function that gets the cost of every block right after it
+ * was highlighted, only while statistics are enabled
+ */
+void QSourceHighliter::setStatisticsCallback(const StatisticsCallback &callback) {
+    _statisticsCallback = callback;
 }
 
 /**
- * @brief Highlight string literals in code
- * @param strType str type i.e., ' or "
- * @param text the text being scanned
- * @param i pos of i in loop
- * @return pos of i after the string
+ * @brief Changes the formats tokens are painted with
+ * @details Every block keeps its tokens, so the document is only painted
+ * again, nothing is lexed. The timing of that is the same as for
+ * rehighlight(), in Asynchronous mode only blocks that were lexed before
+ * are painted right away.
+ * @param formats formats keyed by CodeBlock to CodeBuiltIn, kinds that are
+ * left out keep their current format
  */
-int QSourceHighliter::highlightStringLiterals(QChar strType, const QString &text, int i) {
-    setFormat(i, 1,  _formats[CodeString]);
-    ++i;
-
-    while (i < text.length()) {
-        //make sure it's not an escape seq
-        if (text.at(i) == strType && text.at(i-1) != '\\') {
-            setFormat(i, 1,  _formats[CodeString]);
-            ++i;
-            break;
-        }
-        //look for escape sequence
-        if (text.at(i) == '\\') {
-            //look for space
-            int spacePos = text.indexOf(' ', i);
-            //if space not found, look for the string end
-            //this may present problems in very special cases for e.g \"hello\"
-            if (spacePos == -1) {
-                spacePos = text.indexOf(strType, i);
-            }
-            setFormat(i, spacePos - i, _formats[CodeNumLiteral]);
-            i = spacePos;
-        }
-        setFormat(i, 1,  _formats[CodeString]);
-        ++i;
+void QSourceHighliter::setTheme(const QHash<Language, QTextCharFormat> &formats) {
+    for (auto it = formats.cbegin(); it != formats.cend(); ++it) {
+        if (it.key() >= CodeBlock && it.key() <= CodeBuiltIn)
+            _formats[it.key() - CodeBlock] = it.value();
     }
-    return i;
+    resolveFormats();
+    rehighlight();
 }
 
 /**
- * @brief Highlight number literals in code
- * @param text the text being scanned
- * @param i pos of i in loop
- * @return pos of i after the number
+ * @brief The formats tokens are painted with, keyed by CodeBlock to CodeBuiltIn
  */
-int QSourceHighliter::highlightIntegerLiterals(const QString &text, int i)
-{
-    bool isPreNum = false;
-    if (i == 0) isPreNum = true;
-    else {
-        switch(text[i - 1].toLatin1()) {
-        case '[':
-        case '(':
-        case '{':
-        case ' ':
-        case ',':
-        case '=':
-        case '+':
-        case '-':
-        case '*':
-        case '/':
-        case '%':
-        case '<':
-        case '>':
-            isPreNum = true;
-            break;
-        }
-    }
-    int start = i;
+QHash<QSourceHighliter::Language, QTextCharFormat> QSourceHighliter::theme() const {
+    QHash<Language, QTextCharFormat> formats;
+    for (int kind = QSourceLexer::Block; kind <= QSourceLexer::BuiltIn; ++kind)
+        formats[static_cast<Language>(CodeBlock + kind)] = _formats[kind];
+    return formats;
+}
 
-    if ((i+1) >= text.length()) {
-        if (isPreNum) setFormat(i, 1, _formats[CodeNumLiteral]);
-        return ++i;
-    }
+/**
+ * @brief Sets how the document is highlighted
+ * @details In Asynchronous mode only the blocks passed to setVisibleBlocks()
+ * are lexed on the GUI thread. The other blocks only get the state they end
+ * in until a worker thread has lexed them, the results are then applied in
+ * batches.
+ *
+ * In Deferred mode the other blocks are only scanned for the state they end
+ * in, which skips the words and the formats. They stay unpainted until
+ * setVisibleBlocks() says they are on screen, blocks that are never looked at
+ * are never lexed.
+ *
+ * In Parallel mode every block is highlighted right away like in
+ * Synchronous mode, but when the highlighter comes to a long run of blocks
+ * that were never lexed, the whole run is lexed on all cores before it is
+ * painted. Setting the formats stays on the GUI thread.
+ */
+void QSourceHighliter::setHighlightMode(HighlightMode mode) {
+    if (mode == _mode) return;
+    const bool pending = _pendingFrom >= 0 || _appliedUpTo >= 0;
+    const bool wasDeferred = _mode == Deferred;
+    _mode = mode;
+    _generation.ref();
+    _pendingFrom = -1;
+    _appliedUpTo = -1;
+    //whatever was left to the worker has to be lexed now, blocks that were
+    //never painted are picked up again by the new mode
+    if (((mode == Synchronous || mode == Parallel) && pending) || wasDeferred)
+        rehighlight();
+}
 
-    ++i;
-    //hex numbers highlighting (only if there's a preceding zero)
-    if (text[i] == 'x' && text[i-1] == '0') ++i;
+QSourceHighliter::HighlightMode QSourceHighliter::highlightMode() const {
+    return _mode;
+}
 
-    if (isPreNum) {
-        while (i < text.length()) {
-            if (!text[i].isNumber() && text[i] != '.') break;
-            ++i;
+/**
+ * @brief Tells the highlighter which blocks are on screen
+ * @details Call it whenever the view scrolls or is resized. Visible blocks the
+ * worker hasn't reached yet, or that were skipped in Deferred mode, are lexed
+ * right away.
+ * @param first number of the first visible block
+ * @param last number of the last visible block
+ */
+void QSourceHighliter::setVisibleBlocks(int first, int last) {
+    _firstVisible = first;
+    _lastVisible = last;
+
+    if (_mode == Deferred) {
+        QTextBlock block = document()->findBlockByNumber(first);
+        for (; block.isValid() && block.blockNumber() <= last; block = block.next()) {
+            //a block is painted if its tokens match its text and state
+            const BlockData *data = static_cast<BlockData *>(block.userData());
+            if (!data || data->lexed.textHash != qHash(block.text()) ||
+                data->lexed.inState != blockInState(block))
+                rehighlightBlock(block);
         }
-    } else {
-        return i;
+        return;
     }
 
-    i--;
+    if (_mode != Asynchronous || _appliedUpTo < 0) return;
 
-    bool isPostNum = false;
-    if (i+1 == text.length()) isPostNum = true;
-    else {
-        switch(text[i + 1].toLatin1()) {
-        case ']':
-        case ')':
-        case '}':
-        case ' ':
-        case ',':
-        case '=':
-        case '+':
-        case '-':
-        case '*':
-        case '/':
-        case '%':
-        case '>':
-        case '<':
-        case ';':
-            isPostNum = true;
-            break;
-        case 'u':
-        case 'l':
-        case 'f':
-        case 'U':
-        case 'L':
-        case 'F':
-            isPostNum = true;
-            ++i;
-            break;
-        }
-    }
-    if (isPostNum) {
-        int end = ++i;
-        setFormat(start, end - start, _formats[CodeNumLiteral]);
-    }
-    return i;
+    QTextBlock block = document()->findBlockByNumber(qMax(first, _appliedUpTo));
+    for (; block.isValid() && block.blockNumber() <= last; block = block.next())
+        rehighlightBlock(block);
 }
 
 /**
- * @brief The YAML highlighter
- * @param text
- * @details This function post processes a line after the main syntax
- * highlighter has run for additional highlighting. It does these things
- *
- * 1. Highlight all the words that have a colon after them as 'keyword' except:
- * If the word is a string, skip it.
- * If the colon is in between a path, skip it (C:\)
- *
- * Once the colon is found, the function will skip every character except 'h'
- *
- * 2. If an h letter is found, check the next 4/5 letters for http/https and
- * highlight them as a link (underlined)
+ * @brief The state a block starts in, i.e the state the previous block ends
+ * in, or the language for the first block and after the language changed
  */
-void QSourceHighliter::ymlHighlighter(const QString &text) {
-    if (text.isEmpty()) return;
-    const auto textLen = text.length();
-    bool colonFound = false;
-
-    for (int i = 0; i < textLen; ++i) {
-        if (!text[i].isLetter()) continue;
-
-        if (colonFound && text.at(i) != 'h') continue;
-
-        //we found a string literal, skip it
-        if (text.at(i-1) == '"') {
-            int next = text.indexOf('"', i);
-            i = next;
-            continue;
-        }
+int QSourceHighliter::blockInState(const QTextBlock &block) const {
+    if (block == document()->firstBlock())
+        return _language;
+    const int previous = block.previous().userState();
+    if (previous < 0 || QSourceLexer::stateDocumentLanguage(previous) != _language)
+        return _language;
+    return previous;
+}
 
-        if (text.at(i-1) == '\'') {
-            int next = text.indexOf('"', i);
-            i = next;
-            continue;
+/**
+ * @brief Lexes the current block and the run of never lexed blocks after it
+ * on all cores. The tokens are stored in the user data of the blocks, they
+ * are painted when QSyntaxHighlighter gets to them.
+ * @param text the text of the current block
+ * @param state the state the current block starts in
+ * @return false if the run is too short to be worth it
+ */
+bool QSourceHighliter::lexAhead(const QString &text, int state) {
+    QTextBlock block = currentBlock();
+    int runSize = 1;
+    for (QTextBlock b = block.next(); b.isValid() && !b.userData(); b = b.next()) {
+        if (++runSize >= parallelRunSize) break;
+    }
+    if (runSize < parallelRunSize) return false;
+
+    QVector<QString> texts{text};
+    for (QTextBlock b = block.next(); b.isValid() && !b.userData(); b = b.next())
+        texts.append(b.text());
+    QVector<QStringView> lines;
+    lines.reserve(texts.size());
+    for (const QString &t : qAsConst(texts))
+        lines.append(t);
+
+    QVector<QSourceParallelLexer::Line> lexed = QSourceParallelLexer::lex(lines, state);
+    for (int i = 0; i < lexed.size(); ++i, block = block.next()) {
+        BlockData *data = static_cast<BlockData *>(block.userData());
+        if (!data) {
+            data = new BlockData;
+            block.setUserData(data);
         }
+        data->lexed.tokens = std::move(lexed[i].tokens);
+        data->lexed.textHash = qHash(texts.at(i));
+        data->lexed.inState = state;
+        data->lexed.state = lexed.at(i).state;
+        data->lexedAhead = true;
+        state = lexed.at(i).state;
+    }
+    return true;
+}
 
+/**
+ * @brief Lexes the document from the first skipped block to the end on the
+ * worker thread. A worker that is still running is told to stop, the new one
+ * also takes over the blocks it hasn't delivered yet.
+ */
+void QSourceHighliter::startWorker() {
+    if (_pendingFrom < 0) return;
+    if (_appliedUpTo >= 0)
+        _pendingFrom = qMin(_pendingFrom, _appliedUpTo);
+
+    QTextBlock block = document()->findBlockByNumber(_pendingFrom);
+    if (!block.isValid()) {
+        _pendingFrom = -1;
+        return;
+    }
 
-        int colon = text.indexOf(':', i);
-
-        //if colon isn't found, we don't have anything more to do
-        if (colon == -1) return;
-
-        //colon is found, check if it isn't some path or something else
-        if (!colonFound && (colon+1 < textLen) && !(text[colon+1] == '\\')) {
-            colonFound = true;
-            setFormat(i, colon - i, _formats[CodeKeyWord]);
+    QStringList lines;
+    lines.reserve(document()->blockCount() - _pendingFrom);
+    for (QTextBlock b = block; b.isValid(); b = b.next())
+        lines.append(b.text());
+
+    const int generation = _generation.fetchAndAddOrdered(1) + 1;
+    const int firstBlock = _pendingFrom;
+    const int state = blockInState(block);
+    _appliedUpTo = _pendingFrom;
+    _pendingFrom = -1;
+
+    _pool.start([this, lines, generation, firstBlock, state]() {
+        QVector<LexedBlock> batch;
+        int batchStart = firstBlock;
+        int inState = state;
+        for (int i = 0; i < lines.size(); ++i) {
+            if (_generation.loadAcquire() != generation) return;
+
+            LexedBlock result;
+            result.textHash = qHash(lines.at(i));
+            result.inState = inState;
+            result.state = QSourceLexer::lex(lines.at(i), inState, result.tokens);
+            batch.append(result);
+            inState = result.state;
+
+            if (batch.size() == batchSize || i == lines.size() - 1) {
+                QMetaObject::invokeMethod(this, [this, generation, batchStart, batch]() {
+                    applyResults(generation, batchStart, batch);
+                }, Qt::QueuedConnection);
+                batchStart = firstBlock + i + 1;
+                batch.clear();
+            }
         }
+    });
+}
 
-        //underlined links
-        if (text[i] == 'h') {
-            if (text.midRef(i, 5) == QStringLiteral("https") ||
-                text.midRef(i, 4) == QStringLiteral("http")) {
-                int space = text.indexOf(' ', i);
-                if (space == -1) space = textLen;
-                QTextCharFormat f = _formats[CodeString];
-                f.setUnderlineStyle(QTextCharFormat::SingleUnderline);
-                setFormat(i, space - i, f);
-            }
+/**
+ * @brief Applies a batch of worker results, runs on the GUI thread
+ * @details Results are matched to blocks by number. A block that no longer
+ * has the text or the incoming state of its result was edited or moved since
+ * the snapshot was taken, e.g a line was inserted above it. Such an edit
+ * doesn't necessarily start a worker, the cascade stops at the visible
+ * blocks, so the rest of the document is queued again from that block. The
+ * final state is stored before the block is rehighlighted so that
+ * QSyntaxHighlighter doesn't go on to the next block.
+ */
+void QSourceHighliter::applyResults(int generation, int firstBlock,
+                                    const QVector<LexedBlock> &results) {
+    if (generation != _generation.loadAcquire()) return;
+
+    QTextBlock block = document()->findBlockByNumber(firstBlock);
+    for (const LexedBlock &result : results) {
+        if (!block.isValid()) break;
+        if (qHash(block.text()) != result.textHash ||
+            blockInState(block) != result.inState) {
+            //the results after it are stale too
+            _appliedUpTo = block.blockNumber();
+            if (_pendingFrom < 0)
+                QTimer::singleShot(0, this, [this]() { startWorker(); });
+            if (_pendingFrom < 0 || _appliedUpTo < _pendingFrom)
+                _pendingFrom = _appliedUpTo;
+            return;
         }
+        block.setUserState(result.state);
+        _result = &result;
+        rehighlightBlock(block);
+        _result = nullptr;
+        block = block.next();
     }
+
+    _appliedUpTo = firstBlock + results.size();
+    if (_appliedUpTo >= document()->blockCount())
+        _appliedUpTo = -1;
 }
 
-void QSourceHighliter::cssHighlighter(const QString &text)
+/**
+ * @brief Highlights one block, measuring it if statistics are enabled
+ * @details The cost is counted under the language the block starts in, for
+ * a fenced code block of a markdown document that is the language of the
+ * code.
+ */
+void QSourceHighliter::highlightBlock(const QString &text)
 {
-    if (text.isEmpty()) return;
-    const auto textLen = text.length();
-    for (int i = 0; i<textLen; ++i) {
-        if (text[i] == QLatin1Char('.') || text[i] == QLatin1Char('#')) {
-            if (i+1 >= textLen) return;
-            if (text[i + 1].isSpace() || text[i+1].isNumber()) continue;
-            int space = text.indexOf(QLatin1Char(' '), i);
-            if (space < 0) {
-                space = text.indexOf('{');
-                if (space < 0) {
-                    space = textLen;
-                }
-            }
-            setFormat(i, space - i, _formats[CodeKeyWord]);
-            i = space;
-        } else if (text[i] == QLatin1Char('c')) {
-            if (text.midRef(i, 5) == QLatin1String("color")) {
-                i += 5;
-                int colon = text.indexOf(QLatin1Char(':'), i);
-                if (colon < 0) continue;
-                i = colon;
-                i++;
-                while(i < textLen) {
-                    if (!text[i].isSpace()) break;
-                    i++;
-                }
-                int semicolon = text.indexOf(QLatin1Char(';'));
-                if (semicolon < 0) semicolon = textLen;
-                QString color = text.mid(i, semicolon-i);
-                QTextCharFormat f = _formats[CodeBlock];
-                QColor c(color);
-                if (color.startsWith(QLatin1String("rgb"))) {
-                    int t = text.indexOf('(', i);
-                    int rPos = text.indexOf(',', t);
-                    int gPos = text.indexOf(',', rPos+1);
-                    int bPos = text.indexOf(')', gPos);
-                    if (rPos > -1 && gPos > -1 && bPos > -1) {
-                        const QStringRef r = text.midRef(t+1, rPos - (t+1));
-                        const QStringRef g = text.midRef(rPos+1, gPos - (rPos + 1));
-                        const QStringRef b = text.midRef(gPos+1, bPos - (gPos+1));
-                        c.setRgb(r.toInt(), g.toInt(), b.toInt());
-                    } else {
-                        c = _formats[CodeBlock].background().color();
-                    }
-                }
-
-                if (!c.isValid()) {
-                    continue;
-                }
-
-                int lightness{};
-                QColor foreground;
-                //really dark
-                if (c.lightness() <= 20) {
-                    foreground = Qt::white;
-                } else if (c.lightness() > 20 && c.lightness() <= 51){
-                    foreground = QColor("#ccc");
-                } else if (c.lightness() > 51 && c.lightness() <= 78){
-                    foreground = QColor("#bbb");
-                } else if (c.lightness() > 78 && c.lightness() <= 110){
-                    foreground = QColor("#bbb");
-                } else if (c.lightness() > 127) {
-                    lightness = c.lightness() + 100;
-                    foreground = c.darker(lightness);
-                }
-                else {
-                    lightness = c.lightness() + 100;
-                    foreground = c.lighter(lightness);
-                }
-
-                f.setBackground(c);
-                f.setForeground(foreground);
-                setFormat(i, semicolon - i, QTextCharFormat()); //clear prev format
-                setFormat(i, semicolon - i, f);
-                i = semicolon;
-            }
-        }
+    if (!_statisticsEnabled) {
+        highlight(text, nullptr);
+        return;
     }
+
+    const Language language =
+        static_cast<Language>(QSourceLexer::stateLanguage(blockInState(currentBlock())));
+
+    Statistics block;
+    QElapsedTimer timer;
+    timer.start();
+    highlight(text, &block);
+    block.nsecs = timer.nsecsElapsed();
+    block.blocks = 1;
+
+    _statistics[language] += block;
+    if (_statisticsCallback)
+        _statisticsCallback(language, block);
 }
 
+/**
+ * @brief Highlights one block
+ * @details A block whose text and incoming state match its cached tokens
+ * only gets the cached spans reapplied. Because the cached final state is
+ * set again too, QSyntaxHighlighter stops at the first block whose final
+ * state comes out the same as before.
+ * @param statistics if set, the cost of the block is added to it
+ */
+void QSourceHighliter::highlight(const QString &text, Statistics *statistics)
+{
+    const int state = blockInState(currentBlock());
+    const uint textHash = qHash(text);
+    BlockData *data = static_cast<BlockData *>(currentBlockUserData());
 
-void QSourceHighliter::xmlHighlighter(const QString &text) {
-    if (text.isEmpty()) return;
-    const auto textLen = text.length();
+    bool cached = data && !_result &&
+                  data->lexed.textHash == textHash && data->lexed.inState == state;
 
-    setFormat(0, textLen, _formats[CodeBlock]);
+    if (!cached && !_result && _mode == Parallel && lexAhead(text, state)) {
+        data = static_cast<BlockData *>(currentBlockUserData());
+        cached = true;
+    }
 
-    for (int i = 0; i < textLen; ++i) {
-        if (text[i] == QLatin1Char('<') && text[i+1] != QLatin1Char('!')) {
+    if (!cached && !_result && _mode == Asynchronous &&
+        (currentBlock().blockNumber() < _firstVisible ||
+         currentBlock().blockNumber() > _lastVisible)) {
+        //leave the tokens to the worker, the state is cheap to find now
+        setCurrentBlockState(QSourceLexer::lexState(text, state));
+        if (_pendingFrom < 0)
+            QTimer::singleShot(0, this, [this]() { startWorker(); });
+        if (_pendingFrom < 0 || currentBlock().blockNumber() < _pendingFrom)
+            _pendingFrom = currentBlock().blockNumber();
+        if (statistics) {
+            ++statistics->blocksDeferred;
+            statistics->charactersLexed += quint64(text.size());
+        }
+        return;
+    }
 
-            int found = text.indexOf(QLatin1Char('>'), i);
-            if (found > 0) {
-                ++i;
-                if (text[i] == QLatin1Char('/')) ++i;
-                setFormat(i, found - i, _formats[CodeKeyWord]);
-            }
+    if (!cached && !_result && _mode == Deferred &&
+        (currentBlock().blockNumber() < _firstVisible ||
+         currentBlock().blockNumber() > _lastVisible)) {
+        //carry the state on, the block is painted when it comes into view
+        setCurrentBlockState(QSourceLexer::lexState(text, state));
+        if (statistics) {
+            ++statistics->blocksDeferred;
+            statistics->charactersLexed += quint64(text.size());
         }
+        return;
+    }
 
-        if (text[i] == QLatin1Char('=')) {
-            int lastSpace = text.lastIndexOf(QLatin1Char(' '), i);
-            if (lastSpace == i-1) lastSpace = text.lastIndexOf(QLatin1Char(' '), i-2);
-            if (lastSpace > 0) {
-                setFormat(lastSpace, i - lastSpace, _formats[CodeBuiltIn]);
+    if (!cached) {
+        if (!data) {
+            data = new BlockData;
+            setCurrentBlockUserData(data);
+        }
+        data->lexedAhead = false;
+        if (_result) {
+            //applied from applyResults(), the worker already lexed it
+            data->lexed = *_result;
+        } else {
+            QSourceLexer::Counters counters;
+            data->lexed.textHash = textHash;
+            data->lexed.inState = state;
+            data->lexed.state = QSourceLexer::lex(text, state, data->lexed.tokens,
+                                                  statistics ? &counters : nullptr);
+            if (statistics) {
+                ++statistics->blocksLexed;
+                statistics->charactersLexed += quint64(text.size());
+                statistics->keywordLookups += quint64(counters.lookups);
             }
         }
+    }
+    if (data->lexedAhead) {
+        //the time it took is in the block that started lexAhead()
+        data->lexedAhead = false;
+        if (statistics) {
+            ++statistics->blocksLexed;
+            statistics->charactersLexed += quint64(text.size());
+        }
+    } else if (statistics && (cached || _result)) {
+        ++statistics->blocksReused;
+    }
+    setCurrentBlockState(data->lexed.state);
+
+    //one call for the plain code under the tokens, none if it keeps the
+    //format of the document
+    const QTextCharFormat &blockFormat = _formats[QSourceLexer::Block];
+    int formatCalls = data->lexed.tokens.size();
+    if (!text.isEmpty() && !blockFormat.isEmpty()) {
+        setFormat(0, text.size(), blockFormat);
+        ++formatCalls;
+    }
+    for (const QSourceLexer::Token &token : qAsConst(data->lexed.tokens)) {
+        if (token.kind == QSourceLexer::Color) {
+            //falls back to the code block format if it isn't a color
+            QTextCharFormat f;
+            cssColorFormat(text.mid(token.offset, token.length), f);
+            setFormat(token.offset, token.length, f);
+        } else {
+            setFormat(token.offset, token.length, _formats[token.kind]);
+        }
+    }
+    if (statistics)
+        statistics->formatCalls += quint64(formatCalls);
+}
 
-        if (text[i] == QLatin1Char('\"')) {
-            int pos = i;
-            int cnt = 1;
-            ++i;
-            //bound check
-            if ( (i+1) >= textLen) return;
-            while (i < textLen) {
-                if (text[i] == QLatin1Char('\"')) {
-                    ++cnt;
-                    ++i;
-                    break;
-                }
-                ++i; ++cnt;
-                //bound check
-                if ( (i+1) >= textLen) {
-                    ++cnt;
-                    break;
-                }
-            }
-            setFormat(pos, cnt, _formats[CodeString]);
+/**
+ * @brief Makes the format for the value of a css color property
+ * @param color the value e.g, #fff, red or rgb(0, 0, 0)
+ * @param format receives the color as background and a readable foreground
+ * @return false if the value isn't a valid color
+ */
+bool QSourceHighliter::cssColorFormat(const QString &color, QTextCharFormat &format)
+{
+    format = _formats[QSourceLexer::Block];
+    QColor c(color);
+    if (color.startsWith(QLatin1String("rgb"))) {
+        int t = color.indexOf(QLatin1Char('('));
+        int rPos = color.indexOf(QLatin1Char(','), t);
+        int gPos = color.indexOf(QLatin1Char(','), rPos+1);
+        int bPos = color.indexOf(QLatin1Char(')'), gPos);
+        if (t > -1 && rPos > -1 && gPos > -1 && bPos > -1) {
+            const QStringRef r = color.midRef(t+1, rPos - (t+1));
+            const QStringRef g = color.midRef(rPos+1, gPos - (rPos + 1));
+            const QStringRef b = color.midRef(gPos+1, bPos - (gPos+1));
+            c.setRgb(r.toInt(), g.toInt(), b.toInt());
+        } else {
+            c = _formats[QSourceLexer::Block].background().color();
         }
     }
+
+    if (!c.isValid()) {
+        return false;
+    }
+
+    int lightness{};
+    QColor foreground;
+    //really dark
+    if (c.lightness() <= 20) {
+        foreground = Qt::white;
+    } else if (c.lightness() > 20 && c.lightness() <= 51){
+        foreground = QColor("#ccc");
+    } else if (c.lightness() > 51 && c.lightness() <= 78){
+        foreground = QColor("#bbb");
+    } else if (c.lightness() > 78 && c.lightness() <= 110){
+        foreground = QColor("#bbb");
+    } else if (c.lightness() > 127) {
+        lightness = c.lightness() + 100;
+        foreground = c.darker(lightness);
+    }
+    else {
+        lightness = c.lightness() + 100;
+        foreground = c.lighter(lightness);
+    }
+
+    format.setBackground(c);
+    format.setForeground(foreground);
+    return true;
 }
@@ -14,57 +14,56 @@
 #ifndef QSOURCEHIGHLITER_H
 #define QSOURCEHIGHLITER_H
 
+#include <QAtomicInt>
 #include <QSyntaxHighlighter>
+#include <QThreadPool>
+
+#include <functional>
+
+#include "qsourcelexer.h"
 
 class QSourceHighliter : public QSyntaxHighlighter
 {
 public:
     explicit QSourceHighliter(QTextDocument *doc);
+    ~QSourceHighliter() override;
 
-    //languages
-    /*********
-     * When adding a language make sure that its value is a multiple of 2
-     * This is because we use the next number as comment for that language
-     * In case the language doesn't support multiline comments in the traditional C++
-     * sense, leave the next value empty. Otherwise mark the next value as comment for
-     * that language.
-     * e.g
-     * CodeCpp = 200
-     * CodeCppComment = 201
-     */
+    //languages, see QSourceLexer::Language
     enum Language {
         //languages
-        CodeCpp = 200,
-        CodeCppComment = 201,
-        CodeJs = 202,
-        CodeJsComment = 203,
-        CodeC = 204,
-        CodeCComment = 205,
-        CodeBash = 206,
-        CodePHP = 208,
-        CodePHPComment = 209,
-        CodeQML = 210,
-        CodeQMLComment = 211,
-        CodePython = 212,
-        CodeRust = 214,
-        CodeRustComment = 215,
-        CodeJava = 216,
-        CodeJavaComment = 217,
-        CodeCSharp = 218,
-        CodeCSharpComment = 219,
-        CodeGo = 220,
-        CodeGoComment = 221,
-        CodeV = 222,
-        CodeVComment = 223,
-        CodeSQL = 224,
-        CodeJSON = 226,
-        CodeXML = 228,
-        CodeCSS = 230,
-        CodeCSSComment = 231,
-        CodeTypeScript = 232,
-        CodeTypeScriptComment = 233,
-        CodeYAML = 234,
-        CodeINI = 236,
+        CodeCpp = QSourceLexer::CodeCpp,
+        CodeCppComment = QSourceLexer::CodeCppComment,
+        CodeJs = QSourceLexer::CodeJs,
+        CodeJsComment = QSourceLexer::CodeJsComment,
+        CodeC = QSourceLexer::CodeC,
+        CodeCComment = QSourceLexer::CodeCComment,
+        CodeBash = QSourceLexer::CodeBash,
+        CodePHP = QSourceLexer::CodePHP,
+        CodePHPComment = QSourceLexer::CodePHPComment,
+        CodeQML = QSourceLexer::CodeQML,
+        CodeQMLComment = QSourceLexer::CodeQMLComment,
+        CodePython = QSourceLexer::CodePython,
+        CodeRust = QSourceLexer::CodeRust,
+        CodeRustComment = QSourceLexer::CodeRustComment,
+        CodeJava = QSourceLexer::CodeJava,
+        CodeJavaComment = QSourceLexer::CodeJavaComment,
+        CodeCSharp = QSourceLexer::CodeCSharp,
+        CodeCSharpComment = QSourceLexer::CodeCSharpComment,
+        CodeGo = QSourceLexer::CodeGo,
+        CodeGoComment = QSourceLexer::CodeGoComment,
+        CodeV = QSourceLexer::CodeV,
+        CodeVComment = QSourceLexer::CodeVComment,
+        CodeSQL = QSourceLexer::CodeSQL,
+        CodeJSON = QSourceLexer::CodeJSON,
+        CodeXML = QSourceLexer::CodeXML,
+        CodeXMLComment = QSourceLexer::CodeXMLComment,
+        CodeCSS = QSourceLexer::CodeCSS,
+        CodeCSSComment = QSourceLexer::CodeCSSComment,
+        CodeTypeScript = QSourceLexer::CodeTypeScript,
+        CodeTypeScriptComment = QSourceLexer::CodeTypeScriptComment,
+        CodeYAML = QSourceLexer::CodeYAML,
+        CodeINI = QSourceLexer::CodeINI,
+        CodeMarkdown = QSourceLexer::CodeMarkdown,
 
 
         //code highlighting
@@ -79,23 +78,106 @@ public:
     };
     Q_ENUM(Language)
 
+    enum HighlightMode {
+        //every changed block is lexed right away on the GUI thread
+        Synchronous,
+        //only the visible blocks are lexed on the GUI thread, the rest of the
+        //document is lexed on a worker thread and applied in batches
+        Asynchronous,
+        //only the visible blocks are lexed, the others only get the state
+        //they end in and are highlighted once they are scrolled into view
+        Deferred,
+        //like Synchronous, but a long run of blocks that were never lexed,
+        //e.g after setPlainText() or a big paste, is lexed on all cores first
+        Parallel
+    };
+
+    //what highlighting has cost, see setStatisticsEnabled()
+    struct Statistics {
+        //highlightBlock() calls
+        quint64 blocks = 0;
+        //blocks lexed on the GUI thread, or on all cores in Parallel mode
+        quint64 blocksLexed = 0;
+        //blocks that got their cached spans or a worker result applied
+        quint64 blocksReused = 0;
+        //blocks left to the worker thread, or left unpainted in Deferred mode
+        quint64 blocksDeferred = 0;
+        //characters of the lexed blocks, and of the blocks that were only
+        //scanned for their state in Asynchronous and Deferred mode
+        quint64 charactersLexed = 0;
+        //keyword table lookups, see QSourceLexer::Counters
+        quint64 keywordLookups = 0;
+        quint64 formatCalls = 0;
+        //time spent in highlightBlock()
+        qint64 nsecs = 0;
+
+        Statistics &operator+=(const Statistics &other);
+    };
+    //called after every block with the cost of just that block
+    using StatisticsCallback = std::function<void(Language language, const Statistics &block)>;
+
     void setCurrentLanguage(Language language);
     Language currentLanguage();
 
+    void setStatisticsEnabled(bool enabled);
+    bool statisticsEnabled() const;
+    Statistics statistics(Language language) const;
+    void resetStatistics();
+    void setStatisticsCallback(const StatisticsCallback &callback);
+
+    QTextCharFormat tokenFormat(QSourceLexer::TokenKind kind) const;
+
+    void setTheme(const QHash<Language, QTextCharFormat> &formats);
+    QHash<Language, QTextCharFormat> theme() const;
+
+    void setHighlightMode(HighlightMode mode);
+    HighlightMode highlightMode() const;
+    void setVisibleBlocks(int first, int last);
+
 protected:
     void highlightBlock(const QString &text) override;
 
 private:
-    void highlightSyntax(const QString &text);
-    int highlightIntegerLiterals(const QString &text, int i);
-    int highlightStringLiterals(QChar strType, const QString &text, int i);
-    void cssHighlighter(const QString &text);
-    void ymlHighlighter(const QString &text);
-    void xmlHighlighter(const QString &text);
+    //a lexed block, cached in its user data and produced by the worker
+    struct LexedBlock {
+        QVector<QSourceLexer::Token> tokens;
+        uint textHash;
+        int inState;
+        int state;
+    };
+    class BlockData;
+
+    void highlight(const QString &text, Statistics *statistics);
+    int blockInState(const QTextBlock &block) const;
+    bool lexAhead(const QString &text, int state);
+    void startWorker();
+    void applyResults(int generation, int firstBlock, const QVector<LexedBlock> &results);
+    bool cssColorFormat(const QString &color, QTextCharFormat &format);
     void initFormats();
+    void resolveFormats();
 
-    QHash<Language, QTextCharFormat> _formats;
+    //one format per QSourceLexer::TokenKind
+    static const int formatCount = QSourceLexer::Color + 1;
+    QTextCharFormat _formats[formatCount];
     Language _language;
+
+    HighlightMode _mode = Synchronous;
+    //until the host tells us, assume the top of the document is visible
+    int _firstVisible = 0;
+    int _lastVisible = 99;
+    //first block that was skipped since the worker was last started
+    int _pendingFrom = -1;
+    //next block the running worker will deliver, -1 if none is running
+    int _appliedUpTo = -1;
+    //set while applyResults() rehighlights a block
+    const LexedBlock *_result = nullptr;
+    //bumped to make running workers stop and their results stale
+    QAtomicInt _generation;
+    QThreadPool _pool;
+
+    bool _statisticsEnabled = false;
+    QHash<Language, Statistics> _statistics;
+    StatisticsCallback _statisticsCallback;
 };
 
 #endif // QSOURCEHIGHLITER_H
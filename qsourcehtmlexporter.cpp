@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2019 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 3 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ */
+#include "qsourcehtmlexporter.h"
+
+#include <QIODevice>
+
+/* indexed by QSourceLexer::TokenKind */
+static const char *const classNames[] = {
+    "qsh",
+    "qsh-keyword",
+    "qsh-string",
+    "qsh-comment",
+    "qsh-type",
+    "qsh-other",
+    "qsh-number",
+    "qsh-builtin",
+    "qsh-link",
+    "qsh-color"
+};
+static const int kindCount = sizeof(classNames) / sizeof(classNames[0]);
+
+static void appendEscaped(QString &html, QStringView text) {
+    for (const QChar c : text) {
+        switch (c.unicode()) {
+        case '&': html += QLatin1String("&amp;"); break;
+        case '<': html += QLatin1String("&lt;"); break;
+        case '>': html += QLatin1String("&gt;"); break;
+        case '"': html += QLatin1String("&quot;"); break;
+        default: html += c; break;
+        }
+    }
+}
+
+/* css colors are passed on as they are, as long as they can't break the markup */
+static bool isSafeColor(QStringView color) {
+    if (color.isEmpty()) return false;
+    for (const QChar c : color) {
+        if (!c.isLetterOrNumber() && c != QLatin1Char('#') && c != QLatin1Char('(') &&
+            c != QLatin1Char(')') && c != QLatin1Char(',') && c != QLatin1Char('.') &&
+            c != QLatin1Char('%') && c != QLatin1Char(' '))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @param highlighter the formats are copied from it
+ * @param language the language of the code that is exported
+ * @param style whether spans get classes or inline styles
+ */
+QSourceHtmlExporter::QSourceHtmlExporter(const QSourceHighliter &highlighter,
+                                         QSourceHighliter::Language language,
+                                         Style style)
+    : _language(language)
+{
+    _openTags.resize(kindCount);
+    _rules.resize(kindCount);
+    for (int kind = 0; kind < kindCount; ++kind) {
+        const QTextCharFormat format =
+            highlighter.tokenFormat(static_cast<QSourceLexer::TokenKind>(kind));
+        //the font is set once on the <pre>
+        _rules[kind] = css(format, kind == QSourceLexer::Block);
+    }
+
+    //everything is inside the <pre>, plain code needs no span of its own
+    //and color values get their color inline
+    if (style == CssClasses) {
+        _preTag = QStringLiteral("<pre class=\"qsh\">");
+        for (int kind = QSourceLexer::KeyWord; kind < QSourceLexer::Color; ++kind)
+            _openTags[kind] = QStringLiteral("<span class=\"%1\">").arg(QLatin1String(classNames[kind]));
+    } else {
+        _preTag = QStringLiteral("<pre style=\"%1\">").arg(_rules.at(QSourceLexer::Block));
+        for (int kind = QSourceLexer::KeyWord; kind < QSourceLexer::Color; ++kind)
+            _openTags[kind] = QStringLiteral("<span style=\"%1\">").arg(_rules.at(kind));
+    }
+}
+
+/**
+ * @brief The css rules for the classes used with CssClasses
+ */
+QString QSourceHtmlExporter::styleSheet() const
+{
+    QString sheet;
+    for (int kind = 0; kind < QSourceLexer::Color; ++kind) {
+        if (kind != QSourceLexer::Block)
+            sheet += QLatin1String(".qsh ");
+        sheet += QLatin1Char('.') + QLatin1String(classNames[kind]) +
+                 QLatin1String(" { ") + _rules.at(kind) + QLatin1String(" }\n");
+    }
+    return sheet;
+}
+
+/**
+ * @brief Converts a format into css declarations, only what can be
+ * expressed in css and differs from the defaults is written
+ */
+QString QSourceHtmlExporter::css(const QTextCharFormat &format, bool withFont)
+{
+    QString css;
+    if (withFont && !format.fontFamily().isEmpty())
+        css += QStringLiteral("font-family: '%1', monospace; ").arg(format.fontFamily());
+    if (format.hasProperty(QTextFormat::ForegroundBrush))
+        css += QStringLiteral("color: %1; ").arg(format.foreground().color().name());
+    if (format.hasProperty(QTextFormat::BackgroundBrush))
+        css += QStringLiteral("background-color: %1; ").arg(format.background().color().name());
+    if (format.fontWeight() > QFont::Normal)
+        css += QLatin1String("font-weight: bold; ");
+    if (format.fontItalic())
+        css += QLatin1String("font-style: italic; ");
+    if (format.fontUnderline())
+        css += QLatin1String("text-decoration: underline; ");
+    return css.trimmed();
+}
+
+/**
+ * @brief Reads the code from @p source and writes it to @p device as a
+ * highlighted <pre> element, one line at a time
+ * @return false if the source can't be read or the device can't be written
+ */
+bool QSourceHtmlExporter::exportHtml(QIODevice *source, QIODevice *device) const
+{
+    if (!source || !source->isReadable() || !device || !device->isWritable())
+        return false;
+
+    QVector<QSourceLexer::Token> tokens;
+    QString html = _preTag;
+    int state = _language;
+    bool firstLine = true;
+
+    while (!source->atEnd()) {
+        QByteArray raw = source->readLine();
+        if (raw.endsWith('\n')) raw.chop(1);
+        if (raw.endsWith('\r')) raw.chop(1);
+        const QString line = QString::fromUtf8(raw);
+
+        state = QSourceLexer::lex(line, state, tokens);
+
+        if (!firstLine) html += QLatin1Char('\n');
+        firstLine = false;
+
+        const QStringView text(line);
+        int pos = 0;
+        for (const QSourceLexer::Token &token : qAsConst(tokens)) {
+            appendEscaped(html, text.mid(pos, token.offset - pos));
+            const QStringView value = text.mid(token.offset, token.length);
+            pos = token.offset + token.length;
+
+            if (token.kind == QSourceLexer::Color) {
+                if (isSafeColor(value)) {
+                    html += QLatin1String("<span style=\"background-color: ");
+                    html.append(value.data(), value.size());
+                    html += QLatin1String("\">");
+                    appendEscaped(html, value);
+                    html += QLatin1String("</span>");
+                } else {
+                    appendEscaped(html, value);
+                }
+            } else if (_openTags.at(token.kind).isEmpty()) {
+                appendEscaped(html, value);
+            } else {
+                html += _openTags.at(token.kind);
+                appendEscaped(html, value);
+                html += QLatin1String("</span>");
+            }
+        }
+        appendEscaped(html, text.mid(pos));
+
+        const QByteArray bytes = html.toUtf8();
+        if (device->write(bytes) != bytes.size()) return false;
+        html.clear();
+    }
+
+    html += QLatin1String("</pre>\n");
+    const QByteArray bytes = html.toUtf8();
+    return device->write(bytes) == bytes.size();
+}
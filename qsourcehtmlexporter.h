@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2019 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 3 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ */
+#ifndef QSOURCEHTMLEXPORTER_H
+#define QSOURCEHTMLEXPORTER_H
+
+#include "qsourcehighliter.h"
+
+class QIODevice;
+
+/**
+ * @brief Writes highlighted code as HTML
+ * @details The source is read, lexed and written one line at a time, so
+ * memory use depends on the longest line and not on the size of the file.
+ * The formats are taken from a QSourceHighliter when the exporter is made.
+ */
+class QSourceHtmlExporter
+{
+public:
+    enum Style {
+        //spans get a class, the rules come from styleSheet()
+        CssClasses,
+        //spans carry their own style attribute
+        InlineStyles
+    };
+
+    QSourceHtmlExporter(const QSourceHighliter &highlighter,
+                        QSourceHighliter::Language language,
+                        Style style = CssClasses);
+
+    QString styleSheet() const;
+    bool exportHtml(QIODevice *source, QIODevice *device) const;
+
+private:
+    static QString css(const QTextCharFormat &format, bool withFont);
+
+    //one opening tag per QSourceLexer::TokenKind, empty for plain code
+    QVector<QString> _openTags;
+    //the rules of each class, used by styleSheet()
+    QVector<QString> _rules;
+    QString _preTag;
+    int _language;
+};
+
+#endif // QSOURCEHTMLEXPORTER_H
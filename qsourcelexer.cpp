@@ -0,0 +1,1384 @@
+/*
+ * Copyright (c) 2019 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 3 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ */
+#include "qsourcelexer.h"
+#include "languagedata.h"
+#include "simdscan.h"
+
+#include <QAtomicPointer>
+#include <QMutex>
+#include <QString>
+
+#include <algorithm>
+
+/* what a character can be, a character can be in more than one class */
+enum CharClass : quint8 {
+    CharLetter = 0x01,
+    CharDigit = 0x02,
+    CharSpace = 0x04,
+    CharPunct = 0x08,
+    //  " ' `
+    CharQuote = 0x10,
+    //  / #
+    CharCommentStart = 0x20,
+    //letters and '_'
+    CharIdentifierStart = 0x40,
+    //letters, digits and '_'
+    CharIdentifierChar = 0x80
+};
+
+/* the classes of the ASCII characters, built at compile time. They agree
+ * with QChar::isLetter(), isNumber() and isSpace() for ASCII */
+struct AsciiClasses {
+    quint8 classes[128];
+
+    constexpr AsciiClasses()
+        : classes{}
+    {
+        for (int c = 0; c < 128; ++c) {
+            int cls = 0;
+            if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'))
+                cls = CharLetter | CharIdentifierStart | CharIdentifierChar;
+            else if (c >= '0' && c <= '9')
+                cls = CharDigit | CharIdentifierChar;
+            else if (c == ' ' || (c >= '\t' && c <= '\r'))
+                cls = CharSpace;
+            else if (c == '_')
+                cls = CharIdentifierStart | CharIdentifierChar;
+            else if (c > ' ' && c < 127)
+                cls = CharPunct;
+            if (c == '"' || c == '\'' || c == '`')
+                cls |= CharQuote;
+            if (c == '/' || c == '#')
+                cls |= CharCommentStart;
+            classes[c] = static_cast<quint8>(cls);
+        }
+    }
+};
+static constexpr AsciiClasses asciiClasses;
+
+/**
+ * @brief The classes of a character, a table lookup for ASCII and the
+ * unicode properties of QChar for everything else
+ */
+static inline quint8 charClass(QChar c) {
+    const ushort u = c.unicode();
+    if (Q_LIKELY(u < 128)) return asciiClasses.classes[u];
+
+    if (c.isLetter()) return CharLetter | CharIdentifierStart | CharIdentifierChar;
+    if (c.isNumber()) return CharDigit | CharIdentifierChar;
+    if (c.isSpace()) return CharSpace;
+    return CharPunct;
+}
+
+static inline bool isIdentifierStart(QChar c) {
+    return charClass(c) & CharIdentifierStart;
+}
+
+static inline bool isIdentifierChar(QChar c) {
+    return charClass(c) & CharIdentifierChar;
+}
+
+static inline bool isSpace(QChar c) {
+    return charClass(c) & CharSpace;
+}
+
+static inline bool isNumber(QChar c) {
+    return charClass(c) & CharDigit;
+}
+
+static inline bool isHexDigit(QChar c) {
+    return (c >= QLatin1Char('0') && c <= QLatin1Char('9')) ||
+           (c >= QLatin1Char('a') && c <= QLatin1Char('f')) ||
+           (c >= QLatin1Char('A') && c <= QLatin1Char('F'));
+}
+
+/* the fields of a packed state, see QSourceLexer::Mode */
+static const int languageMask = 0x1FF;
+static const int modeShift = 9;
+static const int depthShift = 12;
+static const int delimiterShift = 15;
+static const int fieldMask = 0x7;
+static const int maxDepth = 7;
+static const int delimiterMask = 0x7FFF;
+//set in the delimiter field if the rest of it is an index into the side table
+static const int delimiterInTable = 0x4000;
+//set inside a fenced code block of a markdown document
+static const int fencedCode = 1 << 30;
+
+static inline int packState(int language, QSourceLexer::Mode mode, int depth = 0,
+                            int delimiter = 0) {
+    return language | (mode << modeShift) | (depth << depthShift) |
+           (delimiter << delimiterShift);
+}
+
+static inline int stateDepth(int state) {
+    return (state >> depthShift) & fieldMask;
+}
+
+static inline int stateDelimiter(int state) {
+    return (state >> delimiterShift) & delimiterMask;
+}
+
+/**
+ * @brief The delimiters that don't fit into a state
+ * @details Shared by every thread that lexes. A document only uses a few
+ * distinct delimiters, so they are never removed. They are kept in chunks
+ * that never move, so looking one up by its index needs no lock, only
+ * adding one does.
+ */
+class DelimiterTable
+{
+public:
+    DelimiterTable() = default;
+    ~DelimiterTable() {
+        for (const auto &chunk : _chunks) delete[] chunk.loadRelaxed();
+    }
+
+    int id(QStringView delimiter) {
+        QMutexLocker locker(&_mutex);
+        for (int i = 0; i < _count; ++i) {
+            if (text(i) == delimiter) return i;
+        }
+        //full, the delimiter is lost and stored as an empty one. A heredoc
+        //then ends at the first empty line, see lexSyntax(), and a raw
+        //string at the first )"
+        if (_count == delimiterInTable) return -1;
+        QString *chunk = _chunks[_count / chunkSize].loadRelaxed();
+        if (!chunk) {
+            chunk = new QString[chunkSize];
+            _chunks[_count / chunkSize].storeRelease(chunk);
+        }
+        chunk[_count % chunkSize] = delimiter.toString();
+        return _count++;
+    }
+
+    /* the text of an id handed out by id(), it stays valid for good */
+    QStringView text(int id) const {
+        return _chunks[id / chunkSize].loadAcquire()[id % chunkSize];
+    }
+
+private:
+    static const int chunkSize = 128;
+
+    QMutex _mutex;
+    int _count = 0;
+    QAtomicPointer<QString> _chunks[delimiterInTable / chunkSize];
+};
+
+static DelimiterTable &delimiterTable() {
+    static DelimiterTable table;
+    return table;
+}
+
+/* up to two ASCII characters are stored right in the state, 7 bits each */
+static int delimiterId(QStringView delimiter) {
+    if (delimiter.size() <= 2) {
+        int id = 0;
+        for (int i = 0; i < delimiter.size(); ++i) {
+            const ushort c = delimiter.at(i).unicode();
+            if (c == 0 || c >= 128) {
+                id = -1;
+                break;
+            }
+            id |= c << (7 * i);
+        }
+        if (id >= 0) return id;
+    }
+    const int index = delimiterTable().id(delimiter);
+    return index < 0 ? 0 : delimiterInTable | index;
+}
+
+/**
+ * @brief The text of a delimiter stored in a state
+ * @param buffer holds the text of a delimiter that is stored right in the
+ * state, the view points into it
+ */
+static QStringView delimiterText(int id, QChar (&buffer)[2]) {
+    if (id & delimiterInTable)
+        return delimiterTable().text(id & ~delimiterInTable);
+    int size = 0;
+    for (int c = id; c != 0; c >>= 7)
+        buffer[size++] = QChar(ushort(c & 0x7F));
+    return QStringView(buffer, size);
+}
+
+/**
+ * @brief Checks for the start of a c++ raw string, e.g R"x(
+ * @param i pos of the quote
+ * @param wordStart receives the pos of the prefix, e.g the R
+ * @return pos of the '(' or -1 if it isn't a raw string
+ */
+static int rawStringParen(QStringView text, int i, int &wordStart) {
+    wordStart = i;
+    while (wordStart > 0 && isIdentifierChar(text[wordStart - 1])) --wordStart;
+    const QStringView prefix = text.mid(wordStart, i - wordStart);
+    if (prefix != QLatin1String("R") && prefix != QLatin1String("LR") &&
+        prefix != QLatin1String("uR") && prefix != QLatin1String("UR") &&
+        prefix != QLatin1String("u8R"))
+        return -1;
+
+    //the delimiter is at most 16 characters and has no spaces or parens
+    const int textLen = text.size();
+    for (int k = i + 1; k < textLen && k <= i + 17; ++k) {
+        const QChar c = text[k];
+        if (c == QLatin1Char('(')) return k;
+        if (isSpace(c) || c == QLatin1Char(')') || c == QLatin1Char('\\') ||
+            c == QLatin1Char('"'))
+            return -1;
+    }
+    return -1;
+}
+
+/**
+ * @brief The words of a language
+ * @details The tables are constant and picked by the language alone, so a
+ * line in any language can be lexed without switching anything.
+ * @return the table, an empty one for languages without words
+ */
+const KeywordTable *QSourceLexer::keywordTable(int language)
+{
+    switch (language) {
+    case CodeCpp:
+    case CodeC:
+        return &cppWords;
+    case CodeJs:
+        return &jsWords;
+    case CodeBash:
+        return &shellWords;
+    case CodePHP:
+        return &phpWords;
+    case CodeQML:
+        return &qmlWords;
+    case CodePython:
+        return &pythonWords;
+    case CodeRust:
+        return &rustWords;
+    case CodeJava:
+        return &javaWords;
+    case CodeCSharp:
+        return &csharpWords;
+    case CodeGo:
+        return &goWords;
+    case CodeV:
+        return &vWords;
+    case CodeSQL:
+        return &sqlWords;
+    case CodeJSON:
+        return &jsonWords;
+    case CodeCSS:
+        return &cssWords;
+    case CodeTypeScript:
+        return &typescriptWords;
+    case CodeYAML:
+        return &yamlWords;
+    default:
+        return &noWords;
+    }
+}
+
+/**
+ * @brief The language of a packed state, without its comment value
+ */
+int QSourceLexer::stateLanguage(int state)
+{
+    return state & languageMask & ~1;
+}
+
+/**
+ * @brief The construct a packed state is inside of
+ */
+QSourceLexer::Mode QSourceLexer::stateMode(int state)
+{
+    return static_cast<Mode>((state >> modeShift) & fieldMask);
+}
+
+/**
+ * @brief Finds where a number ends, shared by the lexer and the state scanner
+ * so that they always continue at the same character
+ * @param i pos of the first digit
+ * @param isLiteral set if the number is highlighted, it spans from i to the
+ * returned pos
+ * @return pos of i after the number
+ */
+static int skipNumber(QStringView text, int i, bool &isLiteral)
+{
+    bool isPreNum = false;
+    isLiteral = false;
+    if (i == 0) isPreNum = true;
+    else {
+        switch(text[i - 1].toLatin1()) {
+        case '[':
+        case '(':
+        case '{':
+        case ' ':
+        case ',':
+        case '=':
+        case '+':
+        case '-':
+        case '*':
+        case '/':
+        case '%':
+        case '<':
+        case '>':
+            isPreNum = true;
+            break;
+        }
+    }
+
+    if ((i+1) >= text.size()) {
+        isLiteral = isPreNum;
+        return ++i;
+    }
+
+    ++i;
+    //hex numbers highlighting (only if there's a preceding zero)
+    if (text[i] == QLatin1Char('x') && text[i-1] == QLatin1Char('0')) ++i;
+
+    if (isPreNum) {
+        while (i < text.size()) {
+            if (!isNumber(text[i]) && text[i] != QLatin1Char('.')) break;
+            ++i;
+        }
+    } else {
+        return i;
+    }
+
+    i--;
+
+    bool isPostNum = false;
+    if (i+1 == text.size()) isPostNum = true;
+    else {
+        switch(text[i + 1].toLatin1()) {
+        case ']':
+        case ')':
+        case '}':
+        case ' ':
+        case ',':
+        case '=':
+        case '+':
+        case '-':
+        case '*':
+        case '/':
+        case '%':
+        case '>':
+        case '<':
+        case ';':
+            isPostNum = true;
+            break;
+        case 'u':
+        case 'l':
+        case 'f':
+        case 'U':
+        case 'L':
+        case 'F':
+            isPostNum = true;
+            ++i;
+            break;
+        }
+    }
+    if (isPostNum) {
+        isLiteral = true;
+        ++i;
+    }
+    return i;
+}
+
+/* the names a fenced code block can give its language, compared without case */
+static const struct {
+    const char *name;
+    QSourceLexer::Language language;
+} languageNames[] = {
+    {"bash", QSourceLexer::CodeBash},
+    {"c", QSourceLexer::CodeC},
+    {"c#", QSourceLexer::CodeCSharp},
+    {"c++", QSourceLexer::CodeCpp},
+    {"cpp", QSourceLexer::CodeCpp},
+    {"cs", QSourceLexer::CodeCSharp},
+    {"csharp", QSourceLexer::CodeCSharp},
+    {"css", QSourceLexer::CodeCSS},
+    {"go", QSourceLexer::CodeGo},
+    {"golang", QSourceLexer::CodeGo},
+    {"html", QSourceLexer::CodeXML},
+    {"ini", QSourceLexer::CodeINI},
+    {"java", QSourceLexer::CodeJava},
+    {"javascript", QSourceLexer::CodeJs},
+    {"js", QSourceLexer::CodeJs},
+    {"json", QSourceLexer::CodeJSON},
+    {"markdown", QSourceLexer::CodeMarkdown},
+    {"md", QSourceLexer::CodeMarkdown},
+    {"php", QSourceLexer::CodePHP},
+    {"py", QSourceLexer::CodePython},
+    {"python", QSourceLexer::CodePython},
+    {"qml", QSourceLexer::CodeQML},
+    {"rs", QSourceLexer::CodeRust},
+    {"rust", QSourceLexer::CodeRust},
+    {"sh", QSourceLexer::CodeBash},
+    {"shell", QSourceLexer::CodeBash},
+    {"sql", QSourceLexer::CodeSQL},
+    {"ts", QSourceLexer::CodeTypeScript},
+    {"typescript", QSourceLexer::CodeTypeScript},
+    {"v", QSourceLexer::CodeV},
+    {"xml", QSourceLexer::CodeXML},
+    {"yaml", QSourceLexer::CodeYAML},
+    {"yml", QSourceLexer::CodeYAML}
+};
+
+/**
+ * @brief Finds a language by the name a fenced code block uses for it, e.g
+ * cpp, python or js
+ * @return the language or -1 if the name is unknown
+ */
+int QSourceLexer::languageForName(QStringView name)
+{
+    for (const auto &entry : languageNames) {
+        if (name.compare(QLatin1String(entry.name), Qt::CaseInsensitive) == 0)
+            return entry.language;
+    }
+    return -1;
+}
+
+/**
+ * @brief The language of the document a packed state belongs to, i.e
+ * CodeMarkdown inside a fenced code block and stateLanguage() otherwise
+ */
+int QSourceLexer::stateDocumentLanguage(int state)
+{
+    return state & fencedCode ? int(CodeMarkdown) : stateLanguage(state);
+}
+
+/**
+ * @brief Checks for a markdown code fence, i.e at least three ` or ~ after
+ * at most three spaces
+ * @return pos after the fence or -1 if the line isn't one
+ */
+static int codeFenceEnd(QStringView text) {
+    const int textLen = text.size();
+    int i = 0;
+    while (i < textLen && i < 3 && text[i] == QLatin1Char(' ')) ++i;
+    if (i == textLen || (text[i] != QLatin1Char('`') && text[i] != QLatin1Char('~')))
+        return -1;
+    const QChar fence = text[i];
+    const int start = i;
+    while (i < textLen && text[i] == fence) ++i;
+    return i - start >= 3 ? i : -1;
+}
+
+enum MarkdownLine {
+    //text of the markdown document
+    ProseLine,
+    //opens or closes a fenced code block
+    FenceLine,
+    //inside a fenced code block, lexed in the language of the block
+    CodeLine
+};
+
+/**
+ * @brief Finds what a line of a markdown document is
+ * @details A fence opens a block in the language its info string names,
+ * e.g ```cpp, and the next fence closes it. A block closes at a ``` or ~~~
+ * fence whichever one opened it, the state has no room for that.
+ * @param endState receives the state a prose or fence line ends in
+ */
+static MarkdownLine markdownLine(QStringView text, int state, int &endState) {
+    const int fenceEnd = codeFenceEnd(text);
+    if (state & fencedCode) {
+        if (fenceEnd < 0) return CodeLine;
+        endState = QSourceLexer::CodeMarkdown;
+        return FenceLine;
+    }
+
+    endState = QSourceLexer::CodeMarkdown;
+    if (fenceEnd < 0) return ProseLine;
+
+    //the first word of the info string is the language
+    int start = fenceEnd;
+    while (start < text.size() && isSpace(text[start])) ++start;
+    int end = start;
+    while (end < text.size() && !isSpace(text[end]) && text[end] != QLatin1Char('{') &&
+           text[end] != QLatin1Char(','))
+        ++end;
+    const int language = QSourceLexer::languageForName(text.mid(start, end - start));
+    //a block in an unknown language is left plain
+    endState = (language < 0 ? int(QSourceLexer::CodeMarkdown) : language) | fencedCode;
+    return FenceLine;
+}
+
+QSourceLexer::QSourceLexer(QStringView text, int state, QVector<Token> &tokens,
+                           Counters *counters)
+    : _text(text),
+      _state(state),
+      _tokens(tokens),
+      _counters(counters)
+{
+}
+
+/**
+ * @brief Lexes one line
+ * @param text the text of the line
+ * @param state the state the previous line ended in, or the language for
+ * the first line
+ * @param tokens receives the spans of the line sorted by offset, they never
+ * overlap and the gaps between them are plain code
+ * @param counters if set, the cost of the line is added to it
+ * @return the state the line ends in
+ */
+int QSourceLexer::lex(QStringView text, int state, QVector<Token> &tokens, Counters *counters)
+{
+    tokens.clear();
+
+    if (stateDocumentLanguage(state) == CodeMarkdown) {
+        int endState;
+        switch (markdownLine(text, state, endState)) {
+        case ProseLine:
+            return endState;
+        case FenceLine: {
+            const Token fence = {0, int(text.size()), Other};
+            if (fence.length > 0) tokens.append(fence);
+            return endState;
+        }
+        case CodeLine:
+            //the tables are picked by the language in the state, nothing is switched
+            if (stateLanguage(state) == CodeMarkdown) return state;
+            return lex(text, state & ~fencedCode, tokens, counters) | fencedCode;
+        }
+    }
+
+    QSourceLexer lexer(text, state, tokens, counters);
+    lexer.lexSyntax();
+    return lexer._state;
+}
+
+/**
+ * @brief Finds only the state a line ends in, many times faster than lex()
+ * @details A separate scanner that only follows what can open or close a
+ * multiline comment, i.e strings, line comments and the characters numbers
+ * swallow, and skips everything else. Nothing is looked up and no tokens are
+ * made. It continues at the same characters as lexSyntax(), so the state
+ * always comes out the same as from lex(). Lines without a comment start
+ * or end are answered with a single search. The few lines that are inside
+ * or may open another construct that spans lines, e.g a python """ string,
+ * are handed to lex().
+ * @return the state the line ends in
+ */
+int QSourceLexer::lexState(QStringView text, int state)
+{
+    const int textLen = text.size();
+
+    if (stateDocumentLanguage(state) == CodeMarkdown) {
+        int endState;
+        if (markdownLine(text, state, endState) != CodeLine) return endState;
+        if (stateLanguage(state) == CodeMarkdown) return state;
+        return lexState(text, state & ~fencedCode) | fencedCode;
+    }
+
+    if (textLen == 0 && stateMode(state) == InCode) return state;
+
+    //lines that are inside or may open a string spanning lines are few, they
+    //are simply lexed
+    bool opens = false;
+    switch (stateLanguage(state)) {
+    case CodePython:
+        opens = text.indexOf(QLatin1String("\"\"\"")) >= 0 ||
+                text.indexOf(QLatin1String("'''")) >= 0;
+        break;
+    case CodeCpp:
+        opens = text.indexOf(QLatin1String("R\"")) >= 0;
+        break;
+    case CodeJs:
+    case CodeTypeScript:
+    case CodeQML:
+        opens = text.indexOf(QLatin1Char('`')) >= 0;
+        break;
+    case CodeBash:
+        opens = text.indexOf(QLatin1String("<<")) >= 0;
+        break;
+    case CodeXML:
+        opens = text.indexOf(state == CodeXMLComment ? QLatin1String("-->")
+                                                     : QLatin1String("<!--")) >= 0;
+        break;
+    default:
+        break;
+    }
+    if (opens || stateMode(state) != InCode) {
+        QVector<Token> tokens;
+        return lex(text, state, tokens);
+    }
+
+    switch (state) {
+    //no multiline comments
+    case CodeBash:
+    case CodePython:
+    case CodeYAML:
+    case CodeINI:
+    case CodeXML:
+    case CodeXMLComment:
+        return state;
+    default:
+        break;
+    }
+
+    int i = 0;
+    if (state % 2 != 0) {
+        const int end = SimdScan::indexOfCommentEnd(text, 0);
+        if (end == -1) return state;
+        --state;
+        //like lexSyntax(), the character after the "*/" is skipped
+        i = end + 3;
+    }
+    if (SimdScan::indexOfCommentStart(text, i) == -1) return state;
+
+    const char16_t stops[2][2] = {{u'"', u'\\'}, {u'\'', u'\\'}};
+    for (; i < textLen; ++i) {
+        const QChar c = text[i];
+        const quint8 cls = charClass(c);
+
+        if (cls & CharIdentifierStart) {
+            while (i + 1 < textLen && isIdentifierChar(text[i + 1])) ++i;
+        } else if (c == QLatin1Char('/') && i + 1 < textLen) {
+            if (text[i + 1] == QLatin1Char('/')) return state;
+            if (text[i + 1] == QLatin1Char('*')) {
+                const int end = SimdScan::indexOfCommentEnd(text, i + 2);
+                if (end == -1) return state + 1;
+                i = end + 2;
+            }
+        } else if (cls & CharDigit) {
+            bool isLiteral;
+            i = skipNumber(text, i, isLiteral);
+        } else if (c == QLatin1Char('"') || c == QLatin1Char('\'')) {
+            //find the closing quote, an escape takes the next character along
+            const char16_t *quoteStops = stops[c == QLatin1Char('"') ? 0 : 1];
+            ++i;
+            while (i < textLen) {
+                i = SimdScan::indexOfAny(text, i, quoteStops, 2);
+                if (i == -1 || text[i] == c) break;
+                i += 2;
+            }
+            if (i == -1) return state;
+        }
+    }
+    return state;
+}
+
+/**
+ * @brief Adds a span, clipped to the line like QSyntaxHighlighter::setFormat
+ * @details Like setFormat, the span overwrites the parts of earlier spans it
+ * overlaps, so the list stays sorted and free of overlaps. A span that
+ * continues the previous one with the same kind extends it instead.
+ */
+void QSourceLexer::addToken(int start, int count, TokenKind kind)
+{
+    const int textLen = _text.size();
+    if (start < 0 || start >= textLen) return;
+    const int end = qMin(start + count, textLen);
+    if (end <= start) return;
+    const Token token = {start, end - start, kind};
+
+    //the common case, spans mostly arrive from left to right
+    if (_tokens.isEmpty() || _tokens.last().offset + _tokens.last().length <= start) {
+        Token *previous = _tokens.isEmpty() ? nullptr : &_tokens.last();
+        if (previous && previous->kind == kind && previous->offset + previous->length == start)
+            previous->length = end - previous->offset;
+        else
+            _tokens.append(token);
+        return;
+    }
+
+    const auto overlap = std::partition_point(_tokens.begin(), _tokens.end(),
+                                              [start](const Token &t) {
+        return t.offset + t.length <= start;
+    });
+    const int first = int(overlap - _tokens.begin());
+    int last = first;
+    while (last < _tokens.size() && _tokens.at(last).offset < end) ++last;
+
+    //keep what sticks out on either side
+    Token replacement[3];
+    int n = 0;
+    if (first < last && _tokens.at(first).offset < start) {
+        replacement[n] = _tokens.at(first);
+        replacement[n++].length = start - _tokens.at(first).offset;
+    }
+    replacement[n++] = token;
+    if (first < last) {
+        const Token &t = _tokens.at(last - 1);
+        if (t.offset + t.length > end) {
+            const Token tail = {end, t.offset + t.length - end, t.kind};
+            replacement[n++] = tail;
+        }
+    }
+
+    _tokens.erase(_tokens.begin() + first, _tokens.begin() + last);
+    while (n > 0)
+        _tokens.insert(first, replacement[--n]);
+}
+
+/**
+ * @brief Does the code syntax highlighting
+ */
+void QSourceLexer::lexSyntax()
+{
+    const QStringView text = _text;
+    if (text.isEmpty()) {
+        //a heredoc whose delimiter was lost to a full table ends here
+        if (stateMode(_state) == InHereDoc && stateDelimiter(_state) == 0)
+            _state = stateLanguage(_state);
+        return;
+    }
+
+    const int textLen = text.size();
+
+    QChar comment;
+    bool isCSS = false;
+    bool isYAML = false;
+    const int language = stateLanguage(_state);
+    //strings that can span lines, other than comments
+    const bool tripleQuotes = language == CodePython;
+    const bool rawStrings = language == CodeCpp;
+    const bool templateLiterals = language == CodeJs || language == CodeTypeScript ||
+                                  language == CodeQML;
+    const bool hereDocs = language == CodeBash;
+
+    // points to the static table of the language, nothing is copied per block
+    const KeywordTable *words = keywordTable(language);
+
+    switch (language) {
+        case CodeBash :
+        case CodePython :
+        case CodeINI :
+            comment = QLatin1Char('#');
+            break;
+        case CodeXML :
+            lexXml();
+            return;
+        case CodeCSS :
+            isCSS = true;
+            break;
+        case CodeYAML:
+            isYAML = true;
+            comment = QLatin1Char('#');
+            break;
+    default:
+        break;
+    }
+
+    // indexed by KeywordTable::Category
+    const TokenKind categoryKinds[] = {
+        Block,
+        Type,
+        KeyWord,
+        NumLiteral,
+        BuiltIn,
+        Other
+    };
+
+    //the previous line ended inside a string, finish it first
+    int start = 0;
+    if (stateMode(_state) != InCode) {
+        start = lexContinuation(language);
+        if (start >= textLen) return;
+    }
+
+    //declared out here, the jump to Comment can't cross its initialization
+    quint8 cls = 0;
+
+    for (int i = start; i < textLen; ++i) {
+
+        if (_state % 2 != 0) goto Comment;
+
+        while (i < textLen && !isIdentifierStart(text[i])) {
+            cls = charClass(text[i]);
+            if (cls & CharSpace) {
+                ++i;
+                //make sure we don't cross the bound
+                if (i == textLen) return;
+                if (isIdentifierStart(text[i])) break;
+                else continue;
+            }
+            //nothing can start at a plain punctuation character
+            if (!(cls & (CharCommentStart | CharDigit | CharQuote))) {
+                if (hereDocs && text[i] == QLatin1Char('<')) {
+                    const int end = lexHereDoc(i);
+                    if (end > i) {
+                        i = end;
+                        continue;
+                    }
+                }
+                ++i;
+                continue;
+            }
+            //inline comment
+            if (comment.isNull() && text[i] == QLatin1Char('/')) {
+                if((i+1) < textLen){
+                    if(text[i+1] == QLatin1Char('/')) {
+                        addToken(i, textLen, Comment);
+                        return;
+                    } else if(text[i+1] == QLatin1Char('*')) {
+                        Comment:
+                        //look for the end after the "/*" that opened the comment
+                        int next = SimdScan::indexOfCommentEnd(text, _state % 2 != 0 ? i : i + 2);
+                        if (next == -1) {
+                            //we didn't find a comment end.
+                            //Check if we are already in a comment block
+                            if (_state % 2 == 0)
+                                _state = _state + 1;
+                            addToken(i, textLen, Comment);
+                            return;
+                        } else {
+                            //we found a comment end
+                            //mark this block as code if it was previously comment
+                            //first check if the comment ended on the same line
+                            //if modulo 2 is not equal to zero, it means we are in a comment
+                            //-1 will set this block's state as language
+                            if (_state % 2 != 0) {
+                                _state = _state - 1;
+                            }
+                            next += 2;
+                            addToken(i, next - i, Comment);
+                            i = next;
+                            if (i >= textLen) return;
+                        }
+                    }
+                }
+            } else if (text[i] == comment) {
+                addToken(i, textLen, Comment);
+                i = textLen;
+            //integer literal
+            } else if (cls & CharDigit) {
+               i = lexIntegerLiteral(i);
+            //string literals
+            } else if (tripleQuotes && i + 2 < textLen && text[i + 1] == text[i] &&
+                       text[i + 2] == text[i] && (text[i] == QLatin1Char('\"') ||
+                                                  text[i] == QLatin1Char('\''))) {
+                const int end = lexTripleQuote(text[i], i, i + 3);
+                if (end < 0) return;
+                i = end - 1;
+            } else if (text[i] == QLatin1Char('\"')) {
+                int prefix = i;
+                const int paren = rawStrings ? rawStringParen(text, i, prefix) : -1;
+                if (paren < 0) {
+                    i = lexStringLiteral(QLatin1Char('\"'), i);
+                } else {
+                    const int end = lexRawString(prefix, paren + 1, text.mid(i + 1, paren - i - 1));
+                    if (end < 0) return;
+                    i = end - 1;
+                }
+            }  else if (text[i] == QLatin1Char('\'')) {
+               i = lexStringLiteral(QLatin1Char('\''), i);
+            } else if (templateLiterals && text[i] == QLatin1Char('`')) {
+                const int end = lexTemplateLiteral(i, i + 1, 0);
+                if (end < 0) return;
+                i = end - 1;
+            }
+            if (i >= textLen) {
+                break;
+            }
+            ++i;
+        }
+
+        if (i == textLen || !isIdentifierStart(text[i])) continue;
+
+        int wordEnd = i + 1;
+        while (wordEnd < textLen && isIdentifierChar(text[wordEnd])) ++wordEnd;
+
+        //only complete words are looked up, never the middle of one
+        if (i == 0 || !isIdentifierChar(text[i - 1])) {
+            const QChar *word = text.data() + i;
+            int wordLen = wordEnd - i;
+
+            //rust macros (e.g, println!) are stored with their '!'
+            KeywordTable::Category category = KeywordTable::None;
+            if (wordEnd < textLen && text[wordEnd] == QLatin1Char('!')) {
+                category = words->lookup(word, wordLen + 1);
+                if (_counters) ++_counters->lookups;
+            }
+            if (category != KeywordTable::None) {
+                ++wordLen;
+            } else {
+                category = words->lookup(word, wordLen);
+                if (_counters) ++_counters->lookups;
+            }
+
+            if (category == KeywordTable::Other && _state == CodeCpp) {
+                //preprocessor, include the '#' as well
+                addToken(i - 1, wordLen + 1, Other);
+            } else if (category != KeywordTable::None) {
+                addToken(i, wordLen, categoryKinds[category]);
+            }
+            wordEnd = i + wordLen;
+        }
+
+        //continue right after the word
+        i = wordEnd - 1;
+    }
+
+    if (isCSS) lexCss();
+    if (isYAML) lexYaml();
+}
+
+/**
+ * @brief Highlight string literals in code
+ * @details Finds the whole extent of the string first and emits one span per
+ * run of plain characters and one per run of escape sequences, never a span
+ * per character.
+ * @param strType str type i.e., ' or "
+ * @param i pos of the opening quote
+ * @return pos of the closing quote, or the line length if there is none
+ */
+int QSourceLexer::lexStringLiteral(QChar strType, int i) {
+    const QStringView text = _text;
+    const int textLen = text.size();
+    const char16_t stops[] = {static_cast<char16_t>(strType.unicode()), u'\\'};
+    int runStart = i;
+    ++i;
+
+    while (i < textLen) {
+        //everything up to the next quote or backslash is part of the run
+        i = SimdScan::indexOfAny(text, i, stops, 2);
+        if (i < 0) break;
+
+        if (text.at(i) == strType) {
+            addToken(runStart, i + 1 - runStart, String);
+            return i;
+        }
+        if (text.at(i) == QLatin1Char('\\') && i + 1 < textLen) {
+            addToken(runStart, i - runStart, String);
+            const int escape = i;
+            const char type = text.at(i + 1).toLatin1();
+            i += 2;
+            //\x7f, \u00e9, \U0001f600 and \012 take some digits along
+            int digits = 0;
+            if (type == 'x') digits = 2;
+            else if (type == 'u') digits = 4;
+            else if (type == 'U') digits = 8;
+            else if (type >= '0' && type <= '7') digits = 2;
+            const bool octal = digits == 2 && type != 'x';
+            while (digits > 0 && i < textLen && (octal ? (text.at(i) >= QLatin1Char('0') &&
+                                                          text.at(i) <= QLatin1Char('7'))
+                                                       : isHexDigit(text.at(i)))) {
+                ++i;
+                --digits;
+            }
+            addToken(escape, i - escape, NumLiteral);
+            runStart = i;
+            continue;
+        }
+        ++i;
+    }
+
+    //no closing quote, the string runs till the end of the line
+    addToken(runStart, textLen - runStart, String);
+    return textLen;
+}
+
+/**
+ * @brief Continues the string the previous line ended inside
+ * @return pos where the code continues, the line length if the string goes
+ * on to the next line as well
+ */
+int QSourceLexer::lexContinuation(int language)
+{
+    const QStringView text = _text;
+    const int textLen = text.size();
+    const int state = _state;
+    //back to code, unless the string doesn't end on this line either
+    _state = language;
+
+    int end = -1;
+    switch (stateMode(state)) {
+    case InTripleQuote:
+        end = lexTripleQuote(stateDepth(state) ? QLatin1Char('\'') : QLatin1Char('"'), 0, 0);
+        break;
+    case InRawString: {
+        QChar buffer[2];
+        end = lexRawString(0, 0, delimiterText(stateDelimiter(state), buffer),
+                           stateDelimiter(state));
+        break;
+    }
+    case InTemplateLiteral:
+        end = lexTemplateLiteral(0, 0, stateDepth(state));
+        break;
+    case InHereDoc: {
+        //the body ends at a line that only has the delimiter, <<- allows tabs before it
+        int first = 0;
+        if (stateDepth(state))
+            while (first < textLen && text[first] == QLatin1Char('\t')) ++first;
+        QChar buffer[2];
+        if (text.mid(first) == delimiterText(stateDelimiter(state), buffer)) {
+            addToken(first, textLen - first, Other);
+        } else {
+            addToken(0, textLen, String);
+            _state = state;
+        }
+        return textLen;
+    }
+    case InCode:
+        return 0;
+    }
+    return end < 0 ? textLen : end;
+}
+
+/**
+ * @brief Highlight a python string opened with """ or '''
+ * @param quote the quote it was opened with
+ * @param start pos of the first quote, or 0 if it started on an earlier line
+ * @param from where to look for the end
+ * @return pos after the closing quotes, or -1 if the string goes on to the
+ * next line, the state then says so
+ */
+int QSourceLexer::lexTripleQuote(QChar quote, int start, int from)
+{
+    const QStringView text = _text;
+    const int textLen = text.size();
+    const char16_t stops[] = {static_cast<char16_t>(quote.unicode()), u'\\'};
+    int i = from;
+
+    while (i < textLen) {
+        i = SimdScan::indexOfAny(text, i, stops, 2);
+        if (i < 0) break;
+        if (text[i] == QLatin1Char('\\')) {
+            i += 2;
+            continue;
+        }
+        if (i + 2 < textLen && text[i + 1] == quote && text[i + 2] == quote) {
+            addToken(start, i + 3 - start, String);
+            return i + 3;
+        }
+        ++i;
+    }
+
+    addToken(start, textLen - start, String);
+    _state = packState(stateLanguage(_state), InTripleQuote, quote == QLatin1Char('\'') ? 1 : 0);
+    return -1;
+}
+
+/**
+ * @brief Highlight a c++ raw string, it ends at ')' + delimiter + '"'
+ * @param start pos of the prefix, or 0 if it started on an earlier line
+ * @param from pos after the '('
+ * @param id the delimiter as it is stored in a state, if it is known
+ * @return pos after the closing quote, or -1 if the string goes on to the
+ * next line, the state then says so
+ */
+int QSourceLexer::lexRawString(int start, int from, QStringView delimiter, int id)
+{
+    const QStringView text = _text;
+    const int textLen = text.size();
+    const QString end = QLatin1Char(')') + delimiter.toString() + QLatin1Char('"');
+
+    const int found = text.indexOf(end, from);
+    if (found >= 0) {
+        addToken(start, found + end.size() - start, String);
+        return found + end.size();
+    }
+
+    addToken(start, textLen - start, String);
+    _state = packState(stateLanguage(_state), InRawString, 0,
+                       id < 0 ? delimiterId(delimiter) : id);
+    return -1;
+}
+
+/**
+ * @brief Highlight a javascript template literal
+ * @details The placeholders are part of the string. Their braces are
+ * counted, so a '`' or '}' inside of them doesn't end the literal, but a
+ * template inside a placeholder has to end on the same line.
+ * @param start pos of the '`', or 0 if it started on an earlier line
+ * @param from where to go on from
+ * @param depth how many braces of placeholders are open at from
+ * @return pos after the closing '`', or -1 if the literal goes on to the
+ * next line, the state then says so
+ */
+int QSourceLexer::lexTemplateLiteral(int start, int from, int depth)
+{
+    const QStringView text = _text;
+    const int textLen = text.size();
+    static const char16_t stops[] = {u'`', u'\\', u'$', u'{', u'}'};
+    static const char16_t nestedStops[] = {u'`', u'\\'};
+    int i = from;
+
+    while (i < textLen) {
+        i = SimdScan::indexOfAny(text, i, stops, 5);
+        if (i < 0) break;
+        const QChar c = text[i];
+
+        if (c == QLatin1Char('\\')) {
+            i += 2;
+            continue;
+        }
+        if (depth == 0) {
+            if (c == QLatin1Char('`')) {
+                addToken(start, i + 1 - start, String);
+                return i + 1;
+            }
+            if (c == QLatin1Char('$') && i + 1 < textLen && text[i + 1] == QLatin1Char('{')) {
+                depth = 1;
+                ++i;
+            }
+        } else if (c == QLatin1Char('{')) {
+            depth = qMin(depth + 1, maxDepth);
+        } else if (c == QLatin1Char('}')) {
+            --depth;
+        } else if (c == QLatin1Char('`')) {
+            //skip over the nested template
+            ++i;
+            while (i < textLen) {
+                i = SimdScan::indexOfAny(text, i, nestedStops, 2);
+                if (i < 0 || text[i] == QLatin1Char('`')) break;
+                i += 2;
+            }
+            if (i < 0) break;
+        }
+        ++i;
+    }
+
+    addToken(start, textLen - start, String);
+    _state = packState(stateLanguage(_state), InTemplateLiteral, depth);
+    return -1;
+}
+
+/* whether pos is inside (( )) or $(( )), where << is a shift */
+static bool inArithmetic(QStringView text, int pos) {
+    int depth = 0;
+    for (int k = 0; k + 1 < pos; ++k) {
+        if (text[k] == QLatin1Char('(') && text[k + 1] == QLatin1Char('(')) {
+            ++depth;
+            ++k;
+        } else if (depth > 0 && text[k] == QLatin1Char(')') && text[k + 1] == QLatin1Char(')')) {
+            --depth;
+            ++k;
+        }
+    }
+    return depth > 0;
+}
+
+/**
+ * @brief Highlight the start of a bash heredoc, e.g <<EOF, <<-EOF or <<'EOF'
+ * @details The body starts on the next line, the state carries the
+ * delimiter there.
+ * @param i pos of the first '<'
+ * @return pos after the delimiter, or i if it isn't a heredoc
+ */
+int QSourceLexer::lexHereDoc(int i)
+{
+    const QStringView text = _text;
+    const int textLen = text.size();
+    //<<< is a here string
+    if (i + 1 >= textLen || text[i + 1] != QLatin1Char('<') ||
+        (i > 0 && text[i - 1] == QLatin1Char('<')) ||
+        (i + 2 < textLen && text[i + 2] == QLatin1Char('<')))
+        return i;
+
+    int j = i + 2;
+    const bool dash = j < textLen && text[j] == QLatin1Char('-');
+    if (dash) ++j;
+    while (j < textLen && text[j] == QLatin1Char(' ')) ++j;
+    QChar quote;
+    if (j < textLen && (text[j] == QLatin1Char('\'') || text[j] == QLatin1Char('"')))
+        quote = text[j++];
+
+    //a delimiter doesn't start with a digit, e.g x << 2 is a shift
+    const int wordStart = j;
+    if (j == textLen || text[j].isDigit()) return i;
+    while (j < textLen && isIdentifierChar(text[j])) ++j;
+    if (j == wordStart || inArithmetic(text, i)) return i;
+    const QStringView delimiter = text.mid(wordStart, j - wordStart);
+    if (!quote.isNull()) {
+        if (j >= textLen || text[j] != quote) return i;
+        ++j;
+    }
+
+    addToken(i, j - i, Other);
+    _state = packState(CodeBash, InHereDoc, dash ? 1 : 0, delimiterId(delimiter));
+    return j;
+}
+
+/**
+ * @brief Highlight number literals in code
+ * @param i pos of i in loop
+ * @return pos of i after the number
+ */
+int QSourceLexer::lexIntegerLiteral(int i)
+{
+    bool isLiteral;
+    const int end = skipNumber(_text, i, isLiteral);
+    if (isLiteral) addToken(i, end - i, NumLiteral);
+    return end;
+}
+
+/**
+ * @brief The YAML highlighter
+ * @details This function post processes a line after the main syntax
+ * highlighter has run for additional highlighting. It does these things
+ *
+ * 1. Highlight all the words that have a colon after them as 'keyword' except:
+ * If the word is a string, skip it.
+ * If the colon is in between a path, skip it (C:\)
+ *
+ * Once the colon is found, the function will skip every character except 'h'
+ *
+ * 2. If an h letter is found, check the next 4/5 letters for http/https and
+ * highlight them as a link (underlined)
+ */
+void QSourceLexer::lexYaml() {
+    const QStringView text = _text;
+    if (text.isEmpty()) return;
+    const int textLen = text.size();
+    bool colonFound = false;
+
+    for (int i = 0; i < textLen; ++i) {
+        if (!(charClass(text[i]) & CharLetter)) continue;
+
+        if (colonFound && text.at(i) != QLatin1Char('h')) continue;
+
+        //we found a string literal, skip it
+        if (i > 0 && (text.at(i-1) == QLatin1Char('"') || text.at(i-1) == QLatin1Char('\''))) {
+            int next = text.indexOf(text.at(i-1), i);
+            if (next == -1) return;
+            i = next;
+            continue;
+        }
+
+        int colon = text.indexOf(QLatin1Char(':'), i);
+
+        //if colon isn't found, we don't have anything more to do
+        if (colon == -1) return;
+
+        //colon is found, check if it isn't some path or something else
+        if (!colonFound && (colon+1 < textLen) && !(text[colon+1] == QLatin1Char('\\'))) {
+            colonFound = true;
+            addToken(i, colon - i, KeyWord);
+        }
+
+        //underlined links
+        if (text[i] == QLatin1Char('h')) {
+            if (text.mid(i).startsWith(QLatin1String("http"))) {
+                int space = text.indexOf(QLatin1Char(' '), i);
+                if (space == -1) space = textLen;
+                addToken(i, space - i, Link);
+            }
+        }
+    }
+}
+
+/**
+ * @brief The CSS highlighter
+ * @details Runs after the main syntax highlighter. Marks class and id
+ * selectors as keywords and the values of color properties as Color, the
+ * highlighter paints those with the color itself.
+ */
+void QSourceLexer::lexCss()
+{
+    const QStringView text = _text;
+    if (text.isEmpty()) return;
+    const int textLen = text.size();
+    for (int i = 0; i<textLen; ++i) {
+        if (text[i] == QLatin1Char('.') || text[i] == QLatin1Char('#')) {
+            if (i+1 >= textLen) return;
+            if (isSpace(text[i + 1]) || isNumber(text[i + 1])) continue;
+            int space = text.indexOf(QLatin1Char(' '), i);
+            if (space < 0) {
+                space = text.indexOf(QLatin1Char('{'), i);
+                if (space < 0) {
+                    space = textLen;
+                }
+            }
+            addToken(i, space - i, KeyWord);
+            i = space;
+        } else if (text[i] == QLatin1Char('c')) {
+            if (text.mid(i).startsWith(QLatin1String("color"))) {
+                i += 5;
+                int colon = text.indexOf(QLatin1Char(':'), i);
+                if (colon < 0) continue;
+                i = colon;
+                i++;
+                while(i < textLen) {
+                    if (!isSpace(text[i])) break;
+                    i++;
+                }
+                int semicolon = text.indexOf(QLatin1Char(';'), i);
+                if (semicolon < 0) semicolon = textLen;
+                addToken(i, semicolon - i, Color);
+                i = semicolon;
+            }
+        }
+    }
+}
+
+void QSourceLexer::lexXml() {
+    const QStringView text = _text;
+    if (text.isEmpty()) return;
+    const int textLen = text.size();
+
+    static const char16_t stops[] = {u'<', u'=', u'"'};
+
+    //the previous line ended inside a comment
+    int from = 0;
+    if (_state == CodeXMLComment) {
+        const int end = text.indexOf(QLatin1String("-->"));
+        if (end < 0) {
+            addToken(0, textLen, Comment);
+            return;
+        }
+        addToken(0, end + 3, Comment);
+        _state = CodeXML;
+        from = end + 3;
+    }
+
+    for (int i = from; i < textLen; ++i) {
+        //nothing happens before the next tag, attribute or value
+        i = SimdScan::indexOfAny(text, i, stops, 3);
+        if (i < 0) return;
+
+        if (text.mid(i).startsWith(QLatin1String("<!--"))) {
+            const int end = text.indexOf(QLatin1String("-->"), i + 4);
+            if (end < 0) {
+                addToken(i, textLen - i, Comment);
+                _state = CodeXMLComment;
+                return;
+            }
+            addToken(i, end + 3 - i, Comment);
+            i = end + 2;
+            continue;
+        }
+
+        if (text[i] == QLatin1Char('<') && i + 1 < textLen && text[i+1] != QLatin1Char('!')) {
+
+            int found = text.indexOf(QLatin1Char('>'), i);
+            if (found > 0) {
+                ++i;
+                if (text[i] == QLatin1Char('/')) ++i;
+                addToken(i, found - i, KeyWord);
+            }
+        }
+
+        if (text[i] == QLatin1Char('=')) {
+            int lastSpace = text.lastIndexOf(QLatin1Char(' '), i);
+            if (lastSpace == i-1 && i >= 2) lastSpace = text.lastIndexOf(QLatin1Char(' '), i-2);
+            if (lastSpace > 0) {
+                addToken(lastSpace, i - lastSpace, BuiltIn);
+            }
+        }
+
+        if (text[i] == QLatin1Char('\"')) {
+            const int pos = i;
+            //bound check
+            if (pos + 2 >= textLen) return;
+            //a value without its closing quote runs till the end of the line
+            int end = text.indexOf(QLatin1Char('\"'), pos + 1);
+            if (end < 0) end = textLen - 1;
+            addToken(pos, end + 1 - pos, String);
+            i = end;
+        }
+    }
+}
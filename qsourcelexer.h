@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2019 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 3 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ */
+#ifndef QSOURCELEXER_H
+#define QSOURCELEXER_H
+
+#include <QStringView>
+#include <QVector>
+
+class KeywordTable;
+
+/**
+ * @brief The scanner behind QSourceHighliter
+ * @details It only depends on QtCore. It takes the text of one line and the
+ * state the previous line ended in, and returns the token spans of the line
+ * together with the state the line ends in. It doesn't keep any state between
+ * calls, so lines can be lexed from any thread.
+ */
+class QSourceLexer
+{
+public:
+    //languages
+    /*********
+     * When adding a language make sure that its value is a multiple of 2
+     * This is because we use the next number as comment for that language
+     * In case the language doesn't support multiline comments in the traditional C++
+     * sense, leave the next value empty. Otherwise mark the next value as comment for
+     * that language.
+     * e.g
+     * CodeCpp = 200
+     * CodeCppComment = 201
+     */
+    enum Language {
+        CodeCpp = 200,
+        CodeCppComment = 201,
+        CodeJs = 202,
+        CodeJsComment = 203,
+        CodeC = 204,
+        CodeCComment = 205,
+        CodeBash = 206,
+        CodePHP = 208,
+        CodePHPComment = 209,
+        CodeQML = 210,
+        CodeQMLComment = 211,
+        CodePython = 212,
+        CodeRust = 214,
+        CodeRustComment = 215,
+        CodeJava = 216,
+        CodeJavaComment = 217,
+        CodeCSharp = 218,
+        CodeCSharpComment = 219,
+        CodeGo = 220,
+        CodeGoComment = 221,
+        CodeV = 222,
+        CodeVComment = 223,
+        CodeSQL = 224,
+        CodeJSON = 226,
+        CodeXML = 228,
+        CodeXMLComment = 229,
+        CodeCSS = 230,
+        CodeCSSComment = 231,
+        CodeTypeScript = 232,
+        CodeTypeScriptComment = 233,
+        CodeYAML = 234,
+        CodeINI = 236,
+        //markdown with fenced code blocks in any of the languages above
+        CodeMarkdown = 238,
+    };
+
+    /*********
+     * The state a line ends in is packed into the 32 bits QSyntaxHighlighter
+     * keeps for every block
+     *
+     * bits 0-8    the language, or its comment value inside a multiline comment
+     * bits 9-11   the construct the line ends inside, see Mode
+     * bits 12-14  a nesting depth, or which quote a string was opened with
+     * bits 15-29  the delimiter of a raw string or heredoc, a delimiter of up
+     *             to two ASCII characters is stored right there, longer ones
+     *             are kept in a side table and stored as its index
+     * bit 30      set inside a fenced code block of a markdown document, the
+     *             language bits are then the language of the block
+     *
+     * A plain language value is still a valid state, it is what the first
+     * line starts in.
+     */
+    enum Mode {
+        //plain code, or the comment of the language
+        InCode = 0,
+        //a python string opened with """ or '''
+        InTripleQuote,
+        //a c++ raw string, e.g R"x( ... )x"
+        InRawString,
+        //a javascript template literal, e.g `text ${value}`
+        InTemplateLiteral,
+        //the body of a bash heredoc, e.g <<EOF
+        InHereDoc
+    };
+
+    static int stateLanguage(int state);
+    static Mode stateMode(int state);
+    static int stateDocumentLanguage(int state);
+    static int languageForName(QStringView name);
+    static const KeywordTable *keywordTable(int language);
+
+    //what a span of text is, in the same order as the formats of QSourceHighliter
+    enum TokenKind : quint8 {
+        //plain code, not emitted, it is what the gaps between tokens are
+        Block = 0,
+        KeyWord,
+        String,
+        Comment,
+        Type,
+        Other,
+        NumLiteral,
+        BuiltIn,
+        //a link inside a string (YAML)
+        Link,
+        //the value of a css color property, e.g #fff or rgb(0, 0, 0)
+        Color
+    };
+
+    struct Token {
+        int offset;
+        int length;
+        TokenKind kind;
+    };
+
+    //what lexing a line cost, only collected when asked for
+    struct Counters {
+        //keyword table lookups, each one compares the word with the few
+        //words of the table that have its first character and length
+        int lookups = 0;
+    };
+
+    static int lex(QStringView text, int state, QVector<Token> &tokens,
+                   Counters *counters = nullptr);
+    static int lexState(QStringView text, int state);
+
+private:
+    QSourceLexer(QStringView text, int state, QVector<Token> &tokens, Counters *counters);
+
+    void lexSyntax();
+    int lexContinuation(int language);
+    int lexIntegerLiteral(int i);
+    int lexStringLiteral(QChar strType, int i);
+    int lexTripleQuote(QChar quote, int start, int from);
+    int lexRawString(int start, int from, QStringView delimiter, int id = -1);
+    int lexTemplateLiteral(int start, int from, int depth);
+    int lexHereDoc(int i);
+    void lexCss();
+    void lexYaml();
+    void lexXml();
+    void addToken(int start, int count, TokenKind kind);
+
+    const QStringView _text;
+    int _state;
+    QVector<Token> &_tokens;
+    Counters *_counters;
+};
+
+Q_DECLARE_TYPEINFO(QSourceLexer::Token, Q_PRIMITIVE_TYPE);
+
+#endif // QSOURCELEXER_H
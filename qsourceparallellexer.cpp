@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2019 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 3 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ */
+#include "qsourceparallellexer.h"
+
+#include <QAtomicInt>
+#include <QSemaphore>
+#include <QSharedPointer>
+#include <QThreadPool>
+
+/* chunks per thread, more of them even out chunks that take longer */
+static const int chunksPerThread = 4;
+
+/**
+ * @brief The chunks of one call, shared by the calling thread and the pool
+ * @details Every thread takes the next chunk until none are left, the
+ * calling thread too. So all chunks get done even if the pool is busy and
+ * none of its threads ever start. A task that only starts after the call
+ * returned finds no chunk left and doesn't touch the lines or the results,
+ * which are gone by then.
+ */
+class ChunkJob
+{
+public:
+    ChunkJob(const QVector<QStringView> &lines, int state, int chunkSize,
+             QSourceParallelLexer::Line *results)
+        : _lines(lines),
+          _state(state),
+          _chunkSize(chunkSize),
+          _chunkCount((lines.size() + chunkSize - 1) / chunkSize),
+          _results(results)
+    {
+    }
+
+    int chunkCount() const { return _chunkCount; }
+    void run();
+    void wait() { _done.acquire(_chunkCount); }
+
+private:
+    void lexChunk(int chunk);
+
+    const QVector<QStringView> &_lines;
+    const int _state;
+    const int _chunkSize;
+    const int _chunkCount;
+    QSourceParallelLexer::Line *const _results;
+    QAtomicInt _next;
+    QSemaphore _done;
+};
+
+void ChunkJob::run()
+{
+    for (;;) {
+        const int chunk = _next.fetchAndAddRelaxed(1);
+        if (chunk >= _chunkCount) return;
+        lexChunk(chunk);
+        _done.release();
+    }
+}
+
+/* lexes a chunk, all but the first guess that they start in plain code */
+void ChunkJob::lexChunk(int chunk)
+{
+    const int begin = chunk * _chunkSize;
+    const int end = qMin(begin + _chunkSize, _lines.size());
+    int state = chunk == 0 ? _state : QSourceLexer::stateDocumentLanguage(_state);
+    for (int i = begin; i < end; ++i) {
+        state = QSourceLexer::lex(_lines.at(i), state, _results[i].tokens);
+        _results[i].state = state;
+    }
+}
+
+/**
+ * @brief Lexes @p lines as if they were lexed one after the other
+ * @param state the state the first line starts in
+ * @param pool the threads to use besides the calling one, the global pool
+ * if none is given
+ * @return the tokens and the final state of every line
+ */
+QVector<QSourceParallelLexer::Line> QSourceParallelLexer::lex(const QVector<QStringView> &lines,
+                                                              int state, QThreadPool *pool)
+{
+    if (!pool) pool = QThreadPool::globalInstance();
+
+    QVector<Line> results(lines.size());
+    if (lines.isEmpty()) return results;
+
+    const int threads = qMax(pool->maxThreadCount(), 0) + 1;
+    const int chunkCount = qMax(1, qMin(lines.size() / minChunkSize, threads * chunksPerThread));
+    const int chunkSize = (lines.size() + chunkCount - 1) / chunkCount;
+
+    const auto job = QSharedPointer<ChunkJob>::create(lines, state, chunkSize, results.data());
+    const int helpers = qMin(threads - 1, job->chunkCount() - 1);
+    for (int i = 0; i < helpers; ++i)
+        pool->start([job]() { job->run(); });
+    job->run();
+    job->wait();
+
+    //the first line of a chunk was guessed to start in plain code, lex again
+    //from where the guess was wrong until a line ends like it did before
+    const int guess = QSourceLexer::stateDocumentLanguage(state);
+    int rightUpTo = chunkSize;
+    for (int begin = chunkSize; begin < lines.size(); begin += chunkSize) {
+        if (begin < rightUpTo) continue;
+        int inState = results.at(begin - 1).state;
+        if (inState == guess) continue;
+
+        int i = begin;
+        for (; i < lines.size(); ++i) {
+            Line &line = results[i];
+            const int before = line.state;
+            line.state = QSourceLexer::lex(lines.at(i), inState, line.tokens);
+            inState = line.state;
+            if (inState == before) break;
+        }
+        rightUpTo = i + 1;
+    }
+    return results;
+}
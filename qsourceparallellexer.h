@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2019 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 3 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ */
+#ifndef QSOURCEPARALLELLEXER_H
+#define QSOURCEPARALLELLEXER_H
+
+#include "qsourcelexer.h"
+
+class QThreadPool;
+
+/**
+ * @brief Lexes many lines at once on all cores
+ * @details The lines are cut into chunks that are lexed concurrently. Only
+ * the first chunk knows the state it starts in, every other chunk guesses
+ * that it starts in plain code, which is right unless a multiline comment or
+ * string runs across its first line. Once all chunks are done, the guesses
+ * are checked in order and a chunk that guessed wrong is lexed again from the
+ * right state, but only up to the first line that ends in the same state as
+ * before, the lines after it were already right. The result is exactly what
+ * lexing the lines one after the other gives.
+ */
+class QSourceParallelLexer
+{
+public:
+    //a lexed line
+    struct Line {
+        QVector<QSourceLexer::Token> tokens;
+        //the state the line ends in
+        int state;
+    };
+
+    //fewer lines than this are lexed on the calling thread
+    static constexpr int minChunkSize = 256;
+
+    static QVector<Line> lex(const QVector<QStringView> &lines, int state,
+                             QThreadPool *pool = nullptr);
+};
+
+Q_DECLARE_TYPEINFO(QSourceParallelLexer::Line, Q_MOVABLE_TYPE);
+
+#endif // QSOURCEPARALLELLEXER_H
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2019 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 3 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ */
+#include "simdscan.h"
+
+#include <QtAlgorithms>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define SIMDSCAN_SSE2
+#  include <emmintrin.h>
+#  if defined(__GNUC__) && !defined(__AVX2__)
+//AVX2 is compiled in for those functions only and picked at runtime
+#    define SIMDSCAN_AVX2_DISPATCH
+#    include <immintrin.h>
+#  elif defined(__AVX2__)
+#    define SIMDSCAN_AVX2
+#    include <immintrin.h>
+#  endif
+#endif
+
+static int indexOfAnyScalar(const char16_t *s, int from, int size,
+                            const char16_t *chars, int count) {
+    for (int i = from; i < size; ++i) {
+        for (int k = 0; k < count; ++k) {
+            if (s[i] == chars[k]) return i;
+        }
+    }
+    return -1;
+}
+
+#ifdef SIMDSCAN_SSE2
+static int indexOfAnySse2(const char16_t *s, int from, int size,
+                          const char16_t *chars, int count) {
+    __m128i needles[SimdScan::maxChars];
+    for (int k = 0; k < count; ++k)
+        needles[k] = _mm_set1_epi16(static_cast<short>(chars[k]));
+
+    int i = from;
+    for (; i + 8 <= size; i += 8) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+        __m128i hits = _mm_cmpeq_epi16(chunk, needles[0]);
+        for (int k = 1; k < count; ++k)
+            hits = _mm_or_si128(hits, _mm_cmpeq_epi16(chunk, needles[k]));
+        const uint mask = uint(_mm_movemask_epi8(hits));
+        //two mask bits per code unit
+        if (mask) return i + int(qCountTrailingZeroBits(mask) / 2);
+    }
+    return indexOfAnyScalar(s, i, size, chars, count);
+}
+#endif
+
+#if defined(SIMDSCAN_AVX2) || defined(SIMDSCAN_AVX2_DISPATCH)
+#ifdef SIMDSCAN_AVX2_DISPATCH
+__attribute__((target("avx2")))
+#endif
+static int indexOfAnyAvx2(const char16_t *s, int from, int size,
+                          const char16_t *chars, int count) {
+    __m256i needles[SimdScan::maxChars];
+    for (int k = 0; k < count; ++k)
+        needles[k] = _mm256_set1_epi16(static_cast<short>(chars[k]));
+
+    int i = from;
+    for (; i + 16 <= size; i += 16) {
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + i));
+        __m256i hits = _mm256_cmpeq_epi16(chunk, needles[0]);
+        for (int k = 1; k < count; ++k)
+            hits = _mm256_or_si256(hits, _mm256_cmpeq_epi16(chunk, needles[k]));
+        const uint mask = uint(_mm256_movemask_epi8(hits));
+        if (mask) return i + int(qCountTrailingZeroBits(mask) / 2);
+    }
+    //the rest is done here as well, calling the SSE2 kernel with the upper
+    //halves of the registers in use costs more than the search itself
+    if (i + 8 <= size) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+        __m128i hits = _mm_cmpeq_epi16(chunk, _mm256_castsi256_si128(needles[0]));
+        for (int k = 1; k < count; ++k)
+            hits = _mm_or_si128(hits, _mm_cmpeq_epi16(chunk, _mm256_castsi256_si128(needles[k])));
+        const uint mask = uint(_mm_movemask_epi8(hits));
+        if (mask) return i + int(qCountTrailingZeroBits(mask) / 2);
+        i += 8;
+    }
+    for (; i < size; ++i) {
+        for (int k = 0; k < count; ++k) {
+            if (s[i] == chars[k]) return i;
+        }
+    }
+    return -1;
+}
+#endif
+
+#if defined(SIMDSCAN_AVX2) || defined(SIMDSCAN_AVX2_DISPATCH)
+static bool hasAvx2() {
+#ifdef SIMDSCAN_AVX2
+    return true;
+#else
+    static const bool avx2 = __builtin_cpu_supports("avx2");
+    return avx2;
+#endif
+}
+#endif
+
+/**
+ * @brief Finds the first of some characters
+ * @param text the text to search
+ * @param from where to start
+ * @param chars the characters to look for
+ * @param count how many there are, at most maxChars
+ * @return the position of the first one found or -1
+ */
+int SimdScan::indexOfAny(QStringView text, int from, const char16_t *chars, int count)
+{
+    Q_ASSERT(count > 0 && count <= maxChars);
+    const int size = int(text.size());
+    if (from < 0 || from >= size) return -1;
+    const char16_t *s = reinterpret_cast<const char16_t *>(text.utf16());
+
+#if defined(SIMDSCAN_AVX2) || defined(SIMDSCAN_AVX2_DISPATCH)
+    if (hasAvx2()) return indexOfAnyAvx2(s, from, size, chars, count);
+#endif
+#ifdef SIMDSCAN_SSE2
+    return indexOfAnySse2(s, from, size, chars, count);
+#else
+    return indexOfAnyScalar(s, from, size, chars, count);
+#endif
+}
+
+/**
+ * @brief Finds the start of a multiline comment, i.e a '/' followed by a '*'
+ * @return the position of the '/' or -1
+ */
+int SimdScan::indexOfCommentStart(QStringView text, int from)
+{
+    const int size = int(text.size());
+    while (true) {
+        from = int(text.indexOf(QLatin1Char('/'), from));
+        if (from < 0 || from + 1 >= size) return -1;
+        if (text.at(from + 1) == QLatin1Char('*')) return from;
+        ++from;
+    }
+}
+
+/**
+ * @brief Finds the end of a multiline comment, i.e the next "*\/"
+ * @return the position of the '*' or -1
+ */
+int SimdScan::indexOfCommentEnd(QStringView text, int from)
+{
+    const int size = int(text.size());
+    while (true) {
+        from = int(text.indexOf(QLatin1Char('*'), from));
+        if (from < 0 || from + 1 >= size) return -1;
+        if (text.at(from + 1) == QLatin1Char('/')) return from;
+        ++from;
+    }
+}
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2019 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 3 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ */
+#ifndef SIMDSCAN_H
+#define SIMDSCAN_H
+
+#include <QStringView>
+
+/**
+ * @brief Vectorized searches the lexer uses to skip over long comments,
+ * strings and markup
+ * @details The searches compare 8 (SSE2) or 16 (AVX2, picked at runtime)
+ * UTF-16 code units at a time and fall back to a plain loop on other
+ * CPUs. Searching for a single character is left to QStringView::indexOf(),
+ * which Qt already vectorizes, the comment searches find the '/' or '*' with
+ * it and then check the next character.
+ */
+class SimdScan
+{
+public:
+    //most characters indexOfAny() can look for at once
+    static const int maxChars = 8;
+
+    static int indexOfAny(QStringView text, int from, const char16_t *chars, int count);
+    static int indexOfCommentStart(QStringView text, int from);
+    static int indexOfCommentEnd(QStringView text, int from);
+};
+
+#endif // SIMDSCAN_H
@@ -0,0 +1,15 @@
+QT       += core gui testlib
+
+include(../../QSourceHighlite.pri)
+
+CONFIG += c++14 console testcase
+CONFIG -= app_bundle
+DEFINES += QT_DEPRECATED_WARNINGS
+
+# the generated documents of the benchmark
+INCLUDEPATH += $$PWD/../../benchmark
+
+TARGET = tst_qsourcehighliter
+
+SOURCES += \
+    tst_qsourcehighliter.cpp
@@ -0,0 +1,484 @@
+/*
+ * Copyright (c) 2019 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 3 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ */
+
+/*
+ * Benchmarks the highlighter on the generated documents of every language:
+ * highlighting the whole document, a single keystroke, opening and closing
+ * a comment above most of the document, and the memory the highlighted
+ * document takes. Also checks that the other highlight modes end up with
+ * the formats and states of Synchronous mode, and which blocks are lexed
+ * again and which get their cached tokens back, that a new theme is painted
+ * without lexing, what the statistics count,
+ * and the HTML the exporter writes.
+ *
+ * Needs a platform for the QGuiApplication, e.g
+ * tst_qsourcehighliter -platform offscreen
+ */
+#include "corpus.h"
+#include "qsourcehighliter.h"
+#include "qsourcehtmlexporter.h"
+
+#include <QBuffer>
+#include <QTextBlock>
+#include <QTextCursor>
+#include <QTextDocument>
+#include <QTextLayout>
+#include <QtTest>
+
+//lines of a generated document
+static const int documentLines = 20000;
+
+/* a small document, every line ends in the language, i.e outside a comment */
+static QString plainCode(int lines) {
+    QString code;
+    for (int i = 0; i < lines; ++i)
+        code += QStringLiteral("int value%1 = %1; // line %1\n").arg(i);
+    return code;
+}
+
+/**
+ * @brief Adds a row with the generated document of every language, or only
+ * of those that have something that can run to the end of the document
+ */
+static void addDocuments(bool withOpener = false) {
+    QTest::addColumn<int>("language");
+    QTest::addColumn<QString>("code");
+    QTest::addColumn<QString>("opener");
+
+    for (const Corpus &corpus : corpora) {
+        if (withOpener && !corpus.opener) continue;
+        QTest::newRow(corpus.name) << int(corpus.language) << makeCorpus(corpus, documentLines)
+                                   << QString::fromLatin1(corpus.opener);
+    }
+}
+
+/**
+ * @brief Checks that every block has the formats and the state of the same
+ * block of the other document
+ * @return the number of the first block that differs, -1 if none does
+ */
+static int firstDifference(QTextDocument &doc, QTextDocument &expected) {
+    if (doc.blockCount() != expected.blockCount()) return qMin(doc.blockCount(), expected.blockCount());
+    QTextBlock b = expected.begin();
+    for (QTextBlock a = doc.begin(); a.isValid(); a = a.next(), b = b.next()) {
+        if (a.userState() != b.userState() || a.layout()->formats() != b.layout()->formats())
+            return a.blockNumber();
+    }
+    return -1;
+}
+
+/* the number of the first block whose state differs, -1 if none does */
+static int firstStateDifference(QTextDocument &doc, QTextDocument &expected) {
+    QTextBlock b = expected.begin();
+    for (QTextBlock a = doc.begin(); a.isValid() && b.isValid(); a = a.next(), b = b.next()) {
+        if (a.userState() != b.userState()) return a.blockNumber();
+    }
+    return doc.blockCount() == expected.blockCount() ? -1 : qMin(doc.blockCount(), expected.blockCount());
+}
+
+/**
+ * @brief Pastes every other line of the code in the middle of the document,
+ * a run of new blocks long enough for Parallel mode
+ */
+static void paste(QTextDocument &doc, const QString &code) {
+    const QStringList lines = code.split(QLatin1Char('\n'));
+    QStringList half;
+    for (int i = 0; i < lines.size(); i += 2)
+        half.append(lines.at(i));
+    QTextCursor cursor(doc.findBlockByNumber(doc.blockCount() / 3));
+    cursor.insertText(half.join(QLatin1Char('\n')) + QLatin1Char('\n'));
+}
+
+class TestQSourceHighliter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void highlight_data();
+    void highlight();
+    void keystroke_data();
+    void keystroke();
+    void comment_data();
+    void comment();
+    void memory_data();
+    void memory();
+    void parallel_data();
+    void parallel();
+    void deferred_data();
+    void deferred();
+    void asynchronous_data();
+    void asynchronous();
+    void cache();
+    void theme();
+    void statistics();
+    void htmlExport_data();
+    void htmlExport();
+};
+
+void TestQSourceHighliter::highlight_data() {
+    addDocuments();
+}
+
+void TestQSourceHighliter::highlight() {
+    QFETCH(int, language);
+    QFETCH(QString, code);
+
+    QTextDocument doc;
+    QSourceHighliter highlighter(&doc);
+    highlighter.setCurrentLanguage(QSourceHighliter::Language(language));
+
+    //the blocks are new every time, so nothing cached is reused
+    QBENCHMARK {
+        doc.setPlainText(code);
+    }
+}
+
+void TestQSourceHighliter::keystroke_data() {
+    addDocuments();
+}
+
+void TestQSourceHighliter::keystroke() {
+    QFETCH(int, language);
+    QFETCH(QString, code);
+
+    QTextDocument doc;
+    QSourceHighliter highlighter(&doc);
+    highlighter.setCurrentLanguage(QSourceHighliter::Language(language));
+    doc.setPlainText(code);
+
+    //a character at the end of a random line, highlighted before
+    //insertText() returns
+    Random random;
+    QBENCHMARK {
+        QTextCursor cursor(doc.findBlockByNumber(random.below(doc.blockCount())));
+        cursor.movePosition(QTextCursor::EndOfBlock);
+        cursor.insertText(QStringLiteral("x"));
+    }
+}
+
+void TestQSourceHighliter::comment_data() {
+    addDocuments(true);
+}
+
+void TestQSourceHighliter::comment() {
+    QFETCH(int, language);
+    QFETCH(QString, code);
+    QFETCH(QString, opener);
+
+    QTextDocument doc;
+    QSourceHighliter highlighter(&doc);
+    highlighter.setCurrentLanguage(QSourceHighliter::Language(language));
+    doc.setPlainText(code);
+
+    //the worst case, everything below is highlighted again twice
+    QBENCHMARK {
+        QTextCursor cursor(doc.findBlockByNumber(doc.blockCount() / 10));
+        cursor.insertText(opener);
+        cursor.movePosition(QTextCursor::Left, QTextCursor::KeepAnchor, opener.size());
+        cursor.removeSelectedText();
+    }
+}
+
+void TestQSourceHighliter::memory_data() {
+    addDocuments();
+}
+
+void TestQSourceHighliter::memory() {
+    QFETCH(int, language);
+    QFETCH(QString, code);
+
+    const qint64 before = memoryKiB("VmRSS");
+    if (before < 0) QSKIP("the memory of the process isn't known on this platform");
+
+    QTextDocument doc;
+    QSourceHighliter highlighter(&doc);
+    highlighter.setCurrentLanguage(QSourceHighliter::Language(language));
+    doc.setPlainText(code);
+
+    //the document and its highlighting, what was freed before may be reused
+    //so this is a lower bound
+    QTest::setBenchmarkResult(qMax<qint64>(memoryKiB("VmRSS") - before, 0) * 1024, QTest::BytesAllocated);
+}
+
+void TestQSourceHighliter::parallel_data() {
+    addDocuments();
+}
+
+void TestQSourceHighliter::parallel() {
+    QFETCH(int, language);
+    QFETCH(QString, code);
+
+    QTextDocument expected;
+    QSourceHighliter synchronous(&expected);
+    synchronous.setCurrentLanguage(QSourceHighliter::Language(language));
+    expected.setPlainText(code);
+
+    QTextDocument doc;
+    QSourceHighliter highlighter(&doc);
+    highlighter.setCurrentLanguage(QSourceHighliter::Language(language));
+    highlighter.setHighlightMode(QSourceHighliter::Parallel);
+    doc.setPlainText(code);
+    QCOMPARE(firstDifference(doc, expected), -1);
+
+    //the new blocks are lexed ahead again
+    paste(expected, code);
+    paste(doc, code);
+    QCOMPARE(firstDifference(doc, expected), -1);
+}
+
+void TestQSourceHighliter::deferred_data() {
+    addDocuments(true);
+}
+
+void TestQSourceHighliter::deferred() {
+    QFETCH(int, language);
+    QFETCH(QString, code);
+    QFETCH(QString, opener);
+
+    QTextDocument expected;
+    QSourceHighliter synchronous(&expected);
+    synchronous.setCurrentLanguage(QSourceHighliter::Language(language));
+    expected.setPlainText(code);
+
+    QTextDocument doc;
+    QSourceHighliter highlighter(&doc);
+    highlighter.setCurrentLanguage(QSourceHighliter::Language(language));
+    highlighter.setHighlightMode(QSourceHighliter::Deferred);
+    highlighter.setVisibleBlocks(0, 49);
+    doc.setPlainText(code);
+
+    //every block has its state, only the visible ones are painted
+    QCOMPARE(firstStateDifference(doc, expected), -1);
+    QTextBlock painted = expected.findBlockByNumber(50);
+    while (painted.isValid() && painted.layout()->formats().isEmpty())
+        painted = painted.next();
+    QVERIFY(painted.isValid());
+    QVERIFY(doc.findBlockByNumber(painted.blockNumber()).layout()->formats().isEmpty());
+
+    //a comment opened at the top changes the state of the blocks below
+    QTextCursor(expected.firstBlock()).insertText(opener);
+    QTextCursor(doc.firstBlock()).insertText(opener);
+    QCOMPARE(firstStateDifference(doc, expected), -1);
+
+    //scrolled over the whole document, everything is painted
+    highlighter.setVisibleBlocks(0, doc.blockCount() - 1);
+    QCOMPARE(firstDifference(doc, expected), -1);
+}
+
+void TestQSourceHighliter::asynchronous_data() {
+    addDocuments(true);
+}
+
+void TestQSourceHighliter::asynchronous() {
+    QFETCH(int, language);
+    QFETCH(QString, code);
+    QFETCH(QString, opener);
+
+    QTextDocument expected;
+    QSourceHighliter synchronous(&expected);
+    synchronous.setCurrentLanguage(QSourceHighliter::Language(language));
+    expected.setPlainText(code);
+
+    QTextDocument doc;
+    QSourceHighliter highlighter(&doc);
+    highlighter.setCurrentLanguage(QSourceHighliter::Language(language));
+    highlighter.setHighlightMode(QSourceHighliter::Asynchronous);
+    highlighter.setVisibleBlocks(0, 49);
+    doc.setPlainText(code);
+
+    //start the worker, then edit the document while it is still lexing, a
+    //comment opened at the top and a keystroke further down
+    QCoreApplication::processEvents();
+    for (QTextDocument *d : {&expected, &doc}) {
+        QTextCursor(d->firstBlock()).insertText(opener);
+        QTextCursor cursor(d->findBlockByNumber(d->blockCount() / 2));
+        cursor.movePosition(QTextCursor::EndOfBlock);
+        cursor.insertText(QStringLiteral("x"));
+    }
+
+    //the worker's results are applied in batches on this thread, none of the
+    //blocks below the visible ones is painted yet
+    QVERIFY(firstDifference(doc, expected) >= 0);
+    QTRY_COMPARE(firstDifference(doc, expected), -1);
+}
+
+void TestQSourceHighliter::cache() {
+    QTextDocument doc;
+    QSourceHighliter highlighter(&doc);
+    highlighter.setStatisticsEnabled(true);
+    doc.setPlainText(plainCode(1000));
+    const quint64 blocks = quint64(doc.blockCount());
+    QCOMPARE(highlighter.statistics(QSourceHighliter::CodeCpp).blocksLexed, blocks);
+
+    //a keystroke that leaves the state alone stops right at its block
+    highlighter.resetStatistics();
+    QTextCursor cursor(doc.findBlockByNumber(500));
+    cursor.movePosition(QTextCursor::EndOfBlock);
+    cursor.insertText(QStringLiteral("x"));
+    QCOMPARE(highlighter.statistics(QSourceHighliter::CodeCpp).blocks, quint64(1));
+    QCOMPARE(highlighter.statistics(QSourceHighliter::CodeCpp).blocksLexed, quint64(1));
+
+    //a comment opened above changes the state of every block below, closing
+    //it again lexes them once more
+    highlighter.resetStatistics();
+    cursor = QTextCursor(doc.findBlockByNumber(100));
+    cursor.insertText(QStringLiteral("/*"));
+    QCOMPARE(highlighter.statistics(QSourceHighliter::CodeCpp).blocks, blocks - 100);
+    cursor.movePosition(QTextCursor::Left, QTextCursor::KeepAnchor, 2);
+    cursor.removeSelectedText();
+    QCOMPARE(highlighter.statistics(QSourceHighliter::CodeCpp).blocksLexed, 2 * (blocks - 100));
+
+    //nothing changed, every block gets its cached tokens
+    highlighter.resetStatistics();
+    highlighter.rehighlight();
+    QCOMPARE(highlighter.statistics(QSourceHighliter::CodeCpp).blocksLexed, quint64(0));
+    QCOMPARE(highlighter.statistics(QSourceHighliter::CodeCpp).blocksReused, blocks);
+}
+
+void TestQSourceHighliter::theme() {
+    QTextDocument doc;
+    QSourceHighliter highlighter(&doc);
+    highlighter.setStatisticsEnabled(true);
+    doc.setPlainText(plainCode(1000));
+
+    QTextCharFormat type;
+    type.setForeground(QColor(QStringLiteral("#123456")));
+    highlighter.resetStatistics();
+    highlighter.setTheme({{QSourceHighliter::CodeType, type}});
+
+    //every block is painted again from its cached tokens
+    QCOMPARE(highlighter.statistics(QSourceHighliter::CodeCpp).blocksLexed, quint64(0));
+    QCOMPARE(highlighter.statistics(QSourceHighliter::CodeCpp).blocksReused, quint64(doc.blockCount()));
+    QCOMPARE(highlighter.theme().value(QSourceHighliter::CodeType).foreground().color(), type.foreground().color());
+
+    //the int at the start of every line has the new color
+    for (QTextBlock block = doc.begin(); block.isValid(); block = block.next()) {
+        if (block.text().isEmpty()) continue;
+        bool painted = false;
+        for (const QTextLayout::FormatRange &range : block.layout()->formats()) {
+            if (range.start == 0 && range.length == 3)
+                painted = range.format.foreground().color() == type.foreground().color();
+        }
+        QVERIFY2(painted, qPrintable(QStringLiteral("block %1").arg(block.blockNumber())));
+    }
+}
+
+void TestQSourceHighliter::statistics() {
+    const QString code = QStringLiteral("# Notes\n\n```python\ndef f():\n    return 1\n```\nSee f.\n");
+
+    QTextDocument doc;
+    QSourceHighliter highlighter(&doc);
+    highlighter.setCurrentLanguage(QSourceHighliter::CodeMarkdown);
+    QHash<int, QSourceHighliter::Statistics> reported;
+    highlighter.setStatisticsCallback([&reported](QSourceHighliter::Language language,
+                                                  const QSourceHighliter::Statistics &block) {
+        QCOMPARE(block.blocks, quint64(1));
+        reported[language] += block;
+    });
+
+    //off by default, nothing is counted or reported
+    QVERIFY(!highlighter.statisticsEnabled());
+    doc.setPlainText(code);
+    QCOMPARE(highlighter.statistics(QSourceHighliter::CodeMarkdown).blocks, quint64(0));
+    QVERIFY(reported.isEmpty());
+
+    //new blocks, the tokens cached above aren't reused
+    highlighter.setStatisticsEnabled(true);
+    doc.setPlainText(code);
+    const QSourceHighliter::Statistics markdown = highlighter.statistics(QSourceHighliter::CodeMarkdown);
+    const QSourceHighliter::Statistics python = highlighter.statistics(QSourceHighliter::CodePython);
+
+    //the lines in the fence count under python
+    QCOMPARE(markdown.blocks + python.blocks, quint64(doc.blockCount()));
+    QVERIFY(python.blocks >= 2);
+    QCOMPARE(python.blocksLexed, python.blocks);
+    QVERIFY(python.keywordLookups > 0);
+    QVERIFY(python.formatCalls > 0);
+
+    //the callback got every block, under the same language
+    QCOMPARE(reported.size(), 2);
+    for (QSourceHighliter::Language language : {QSourceHighliter::CodeMarkdown, QSourceHighliter::CodePython}) {
+        const QSourceHighliter::Statistics total = highlighter.statistics(language);
+        const QSourceHighliter::Statistics &sum = reported[language];
+        QCOMPARE(sum.blocks, total.blocks);
+        QCOMPARE(sum.blocksLexed, total.blocksLexed);
+        QCOMPARE(sum.blocksReused, total.blocksReused);
+        QCOMPARE(sum.charactersLexed, total.charactersLexed);
+        QCOMPARE(sum.keywordLookups, total.keywordLookups);
+        QCOMPARE(sum.formatCalls, total.formatCalls);
+        QCOMPARE(sum.nsecs, total.nsecs);
+    }
+
+    highlighter.resetStatistics();
+    QCOMPARE(highlighter.statistics(QSourceHighliter::CodePython).blocks, quint64(0));
+}
+
+void TestQSourceHighliter::htmlExport_data() {
+    QTest::addColumn<int>("style");
+    QTest::addColumn<QByteArray>("html");
+
+    QTest::newRow("classes")
+        << int(QSourceHtmlExporter::CssClasses)
+        << QByteArray("<pre class=\"qsh\"><span class=\"qsh-keyword\">return</span> a &lt; b &amp;&amp; s == "
+                      "<span class=\"qsh-string\">&quot;&lt;p&gt;&quot;</span>; <span class=\"qsh-comment\">/* x</span>\n"
+                      "<span class=\"qsh-comment\">*/</span> }</pre>\n");
+    QTest::newRow("inline styles")
+        << int(QSourceHtmlExporter::InlineStyles)
+        << QByteArray("<pre style=\"font-family: 'Courier', monospace; color: #000000;\">"
+                      "<span style=\"color: #ff0000; font-weight: bold;\">return</span> a &lt; b &amp;&amp; s == "
+                      "<span style=\"color: #008000;\">&quot;&lt;p&gt;&quot;</span>; "
+                      "<span style=\"color: #808080; font-style: italic;\">/* x</span>\n"
+                      "<span style=\"color: #808080; font-style: italic;\">*/</span> }</pre>\n");
+}
+
+void TestQSourceHighliter::htmlExport() {
+    QFETCH(int, style);
+    QFETCH(QByteArray, html);
+
+    //all that is used is set, the default formats depend on the system font
+    QTextCharFormat block;
+    block.setFontFamily(QStringLiteral("Courier"));
+    block.setForeground(QColor(QStringLiteral("#000000")));
+    QTextCharFormat keyword;
+    keyword.setForeground(QColor(QStringLiteral("#ff0000")));
+    keyword.setFontWeight(QFont::Bold);
+    QTextCharFormat string;
+    string.setForeground(QColor(QStringLiteral("#008000")));
+    QTextCharFormat comment;
+    comment.setForeground(QColor(QStringLiteral("#808080")));
+    comment.setFontItalic(true);
+
+    QTextDocument doc;
+    QSourceHighliter highlighter(&doc);
+    highlighter.setTheme({{QSourceHighliter::CodeBlock, block}, {QSourceHighliter::CodeKeyWord, keyword},
+                          {QSourceHighliter::CodeString, string}, {QSourceHighliter::CodeComment, comment}});
+
+    //markup in the code is escaped, a comment goes on over the line end
+    QByteArray code("return a < b && s == \"<p>\"; /* x\r\n*/ }\n");
+    QBuffer source(&code);
+    QVERIFY(source.open(QIODevice::ReadOnly));
+    QBuffer output;
+    QVERIFY(output.open(QIODevice::WriteOnly));
+
+    const QSourceHtmlExporter exporter(highlighter, QSourceHighliter::CodeCpp,
+                                       QSourceHtmlExporter::Style(style));
+    QVERIFY(exporter.exportHtml(&source, &output));
+    QCOMPARE(output.data(), html);
+    if (style == QSourceHtmlExporter::CssClasses)
+        QVERIFY(exporter.styleSheet().contains(QLatin1String(".qsh .qsh-keyword { color: #ff0000; font-weight: bold; }")));
+}
+
+QTEST_MAIN(TestQSourceHighliter)
+
+#include "tst_qsourcehighliter.moc"
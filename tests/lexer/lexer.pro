@@ -0,0 +1,16 @@
+QT       += core testlib
+QT       -= gui
+
+include(../../QSourceLexer.pri)
+
+CONFIG += c++14 console testcase
+CONFIG -= app_bundle
+DEFINES += QT_DEPRECATED_WARNINGS
+
+# the generated documents and the samples of the benchmark
+INCLUDEPATH += $$PWD/../../benchmark
+
+TARGET = tst_qsourcelexer
+
+SOURCES += \
+    tst_qsourcelexer.cpp
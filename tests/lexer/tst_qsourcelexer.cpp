@@ -0,0 +1,503 @@
+/*
+ * Copyright (c) 2019 Waqar Ahmed -- <waqar.17a@gmail.com>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 3 of the License.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ */
+
+/*
+ * Checks everything that has to give the same result as lexing the lines
+ * one after the other, lexState(), the parallel lexer and the file lexer,
+ * on the generated
+ * documents of the benchmark and on random fragments. Also
+ * checks which lines open a bash heredoc or a c++ raw string, and which
+ * lines close them again, the fences of markdown, the spans of string
+ * literals, and the detector on the samples of the benchmark.
+ */
+#include "corpus.h"
+#include "qsourcedetector.h"
+#include "qsourcefilelexer.h"
+#include "qsourcelexer.h"
+#include "qsourceparallellexer.h"
+#include "samples.h"
+
+#include <QTemporaryFile>
+#include <QThreadPool>
+#include <QtTest>
+
+//lines of a generated document, enough for many parallel chunks
+static const int documentLines = 5000;
+
+//pieces that open, close or hide the multiline constructs of all languages
+static const char *const fragments[] = {
+    "/*", "*/", "\"\"\"", "'''", "`", "${", "}", "R\"x(", ")x\"", "<<EOF", "EOF",
+    "<!--", "-->", "```python", "```", "x = 1;", "// c", "# h", "int a;", "\"s\""
+};
+
+/**
+ * @brief Makes lines of a few random fragments each, so that constructs are
+ * opened and closed in every possible order
+ */
+static QStringList fragmentLines(int lines) {
+    const int fragmentCount = int(sizeof(fragments) / sizeof(fragments[0]));
+    Random random;
+    QStringList result;
+    for (int i = 0; i < lines; ++i) {
+        QString line;
+        const int count = random.below(4);
+        for (int j = 0; j < count; ++j) {
+            line += QLatin1String(fragments[random.below(fragmentCount)]);
+            line += QLatin1Char(' ');
+        }
+        result.append(line);
+    }
+    return result;
+}
+
+/**
+ * @brief Lexes the lines one after the other, this is what everything else
+ * is compared with
+ */
+static QVector<QSourceParallelLexer::Line> lexLines(const QStringList &lines, int state) {
+    QVector<QSourceParallelLexer::Line> result(lines.size());
+    for (int i = 0; i < lines.size(); ++i) {
+        state = QSourceLexer::lex(lines.at(i), state, result[i].tokens);
+        result[i].state = state;
+    }
+    return result;
+}
+
+static bool sameTokens(const QVector<QSourceLexer::Token> &a, const QVector<QSourceLexer::Token> &b) {
+    if (a.size() != b.size()) return false;
+    for (int i = 0; i < a.size(); ++i) {
+        if (a.at(i).offset != b.at(i).offset || a.at(i).length != b.at(i).length ||
+            a.at(i).kind != b.at(i).kind)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Adds a row for the generated document of every language, for the
+ * same document with a comment opened at the top, and for random fragments
+ * lexed as every language
+ */
+static void addDocuments() {
+    QTest::addColumn<int>("language");
+    QTest::addColumn<QStringList>("lines");
+
+    for (const Corpus &corpus : corpora) {
+        const QString code = makeCorpus(corpus, documentLines);
+        QTest::newRow(corpus.name) << int(corpus.language) << code.split(QLatin1Char('\n'));
+        if (corpus.opener) {
+            QTest::addRow("%s opened", corpus.name)
+                << int(corpus.language)
+                << (QString::fromLatin1(corpus.opener) + code).split(QLatin1Char('\n'));
+        }
+    }
+
+    const QStringList lines = fragmentLines(documentLines);
+    for (const Corpus &corpus : corpora)
+        QTest::addRow("%s fragments", corpus.name) << int(corpus.language) << lines;
+    QTest::newRow("fragments in a comment") << int(QSourceLexer::CodeCppComment) << lines;
+}
+
+class TestQSourceLexer : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void lexState_data();
+    void lexState();
+    void parallel_data();
+    void parallel();
+    void fileLexer_data();
+    void fileLexer();
+    void hereDoc_data();
+    void hereDoc();
+    void rawString_data();
+    void rawString();
+    void codeFence_data();
+    void codeFence();
+    void stringLiteral_data();
+    void stringLiteral();
+    void detector_data();
+    void detector();
+    void detectSignature_data();
+    void detectSignature();
+    //fills the delimiter table of the whole process, so it has to run last
+    void lostDelimiter();
+};
+
+void TestQSourceLexer::lexState_data() {
+    addDocuments();
+}
+
+void TestQSourceLexer::lexState() {
+    QFETCH(int, language);
+    QFETCH(QStringList, lines);
+
+    QVector<QSourceLexer::Token> tokens;
+    int state = language;
+    for (int i = 0; i < lines.size(); ++i) {
+        const int expected = QSourceLexer::lex(lines.at(i), state, tokens);
+        const int actual = QSourceLexer::lexState(lines.at(i), state);
+        QVERIFY2(actual == expected,
+                 qPrintable(QStringLiteral("line %1 ends in %2 instead of %3")
+                                .arg(i + 1).arg(actual).arg(expected)));
+        state = expected;
+    }
+}
+
+void TestQSourceLexer::parallel_data() {
+    addDocuments();
+}
+
+void TestQSourceLexer::parallel() {
+    QFETCH(int, language);
+    QFETCH(QStringList, lines);
+
+    const QVector<QSourceParallelLexer::Line> expected = lexLines(lines, language);
+
+    QVector<QStringView> views;
+    views.reserve(lines.size());
+    for (const QString &line : qAsConst(lines))
+        views.append(line);
+
+    //more threads than most test machines have cores, so chunks finish out
+    //of order everywhere
+    QThreadPool pool;
+    pool.setMaxThreadCount(16);
+    const QVector<QSourceParallelLexer::Line> lexed = QSourceParallelLexer::lex(views, language, &pool);
+
+    QCOMPARE(lexed.size(), expected.size());
+    for (int i = 0; i < lexed.size(); ++i) {
+        QVERIFY2(lexed.at(i).state == expected.at(i).state &&
+                 sameTokens(lexed.at(i).tokens, expected.at(i).tokens),
+                 qPrintable(QStringLiteral("line %1 differs").arg(i + 1)));
+    }
+}
+
+void TestQSourceLexer::fileLexer_data() {
+    QTest::addColumn<int>("language");
+    QTest::addColumn<QString>("text");
+    QTest::addColumn<bool>("bom");
+    QTest::addColumn<bool>("crlf");
+
+    for (const Corpus &corpus : corpora)
+        QTest::newRow(corpus.name) << int(corpus.language) << makeCorpus(corpus, documentLines) << false << false;
+
+    const QString code = makeCorpus(corpora[0], documentLines);
+    QTest::newRow("crlf") << int(QSourceLexer::CodeCpp) << code << false << true;
+    QTest::newRow("bom") << int(QSourceLexer::CodeCpp) << code << true << false;
+    QTest::newRow("no newline at the end") << int(QSourceLexer::CodeCpp) << code.left(code.size() - 1) << false << false;
+    QTest::newRow("empty") << int(QSourceLexer::CodeCpp) << QString() << false << false;
+    QTest::newRow("utf-8") << int(QSourceLexer::CodeCpp)
+                           << QString::fromUtf8("// gr\xC3\xB6\xC3\x9F" "e \xE2\x9C\x93 \xF0\x9D\x84\x9E\n"
+                                                "int x = 1; /* \xC3\xBC\n"
+                                                "*/ auto s = \"\xE2\x82\xAC\";\n")
+                           << false << false;
+
+    //lines that run over the end of a window
+    QString large;
+    while (large.size() <= QSourceFileLexer::windowSize)
+        large += code;
+    QTest::newRow("larger than a window") << int(QSourceLexer::CodeCpp) << large << false << false;
+}
+
+void TestQSourceLexer::fileLexer() {
+    QFETCH(int, language);
+    QFETCH(QString, text);
+    QFETCH(bool, bom);
+    QFETCH(bool, crlf);
+
+    QTemporaryFile file;
+    QVERIFY(file.open());
+    if (bom) file.write("\xEF\xBB\xBF");
+    if (crlf) text.replace(QLatin1Char('\n'), QLatin1String("\r\n"));
+    file.write(text.toUtf8());
+    file.close();
+    if (crlf) text.remove(QLatin1Char('\r'));
+
+    //a file that ends with a newline ends with an empty line, like a QTextDocument
+    const QStringList lines = text.split(QLatin1Char('\n'));
+    const QVector<QSourceParallelLexer::Line> expected = lexLines(lines, language);
+
+    qint64 count = 0;
+    qint64 firstDifference = -1;
+    const bool ok = QSourceFileLexer::lexFile(file.fileName(), language,
+        [&](qint64 line, QStringView lineText, const QVector<QSourceLexer::Token> &tokens) {
+            const bool same = line == count && line < lines.size() &&
+                              lineText.compare(lines.at(int(line))) == 0 &&
+                              sameTokens(tokens, expected.at(int(line)).tokens);
+            if (!same && firstDifference < 0) firstDifference = count;
+            ++count;
+        });
+
+    QVERIFY(ok);
+    QVERIFY2(firstDifference < 0, qPrintable(QStringLiteral("line %1 differs").arg(firstDifference + 1)));
+    QCOMPARE(count, qint64(lines.size()));
+}
+
+void TestQSourceLexer::hereDoc_data() {
+    QTest::addColumn<QString>("line");
+    QTest::addColumn<bool>("opens");
+    QTest::addColumn<QString>("end");
+
+    const QString eof = QStringLiteral("EOF");
+    QTest::newRow("plain") << QStringLiteral("cat <<EOF") << true << eof;
+    QTest::newRow("quoted") << QStringLiteral("cat <<'EOF'") << true << eof;
+    QTest::newRow("double quoted") << QStringLiteral("cat <<\"EOF\"") << true << eof;
+    QTest::newRow("indented") << QStringLiteral("cat <<-EOF") << true << QStringLiteral("\t\tEOF");
+    QTest::newRow("short delimiter") << QStringLiteral("cat <<E") << true << QStringLiteral("E");
+    QTest::newRow("long delimiter") << QStringLiteral("cat << END_OF_THE_TEXT") << true
+                                    << QStringLiteral("END_OF_THE_TEXT");
+    QTest::newRow("after arithmetic") << QStringLiteral("y=$(( (a+1) << b )); cat <<EOF") << true << eof;
+    QTest::newRow("after a closed $((") << QStringLiteral("echo $((1+2)) <<EOF") << true << eof;
+    QTest::newRow("shift in $((") << QStringLiteral("x=$((1 << 2))") << false << eof;
+    QTest::newRow("shift in ((") << QStringLiteral("(( x << y ))") << false << eof;
+    QTest::newRow("digit") << QStringLiteral("cat <<2EOF") << false << eof;
+    QTest::newRow("here string") << QStringLiteral("cat <<<EOF") << false << eof;
+}
+
+void TestQSourceLexer::hereDoc() {
+    QFETCH(QString, line);
+    QFETCH(bool, opens);
+    QFETCH(QString, end);
+
+    QVector<QSourceLexer::Token> tokens;
+    const int state = QSourceLexer::lex(line, QSourceLexer::CodeBash, tokens);
+    QCOMPARE(QSourceLexer::stateMode(state) == QSourceLexer::InHereDoc, opens);
+    QCOMPARE(QSourceLexer::lexState(line, QSourceLexer::CodeBash), state);
+    if (!opens) return;
+
+    //the body goes on over empty lines and other delimiters
+    for (const QString &body : {QString(), QStringLiteral("EOFX"), QStringLiteral(" ") + end}) {
+        QCOMPARE(QSourceLexer::lex(body, state, tokens), state);
+        QCOMPARE(QSourceLexer::lexState(body, state), state);
+    }
+
+    //a line with only the delimiter closes it
+    QCOMPARE(QSourceLexer::lex(end, state, tokens), int(QSourceLexer::CodeBash));
+    QCOMPARE(QSourceLexer::lexState(end, state), int(QSourceLexer::CodeBash));
+}
+
+void TestQSourceLexer::rawString_data() {
+    QTest::addColumn<QString>("line");
+    QTest::addColumn<bool>("opens");
+    QTest::addColumn<QString>("end");
+
+    QTest::newRow("plain") << QStringLiteral("auto s = R\"(text") << true << QStringLiteral(")\";");
+    QTest::newRow("delimiter") << QStringLiteral("auto s = R\"xy(text)\"") << true << QStringLiteral(")xy\";");
+    QTest::newRow("long delimiter") << QStringLiteral("auto s = R\"delimiter(") << true
+                                    << QStringLiteral("a)delimiter\"");
+    QTest::newRow("utf-8") << QStringLiteral("auto s = u8R\"(") << true << QStringLiteral(")\"");
+    QTest::newRow("wide") << QStringLiteral("auto s = LR\"(") << true << QStringLiteral(")\"");
+    QTest::newRow("closed") << QStringLiteral("auto s = R\"x(a)x\";") << false << QString();
+    QTest::newRow("not a prefix") << QStringLiteral("auto s = xR\"(a\";") << false << QString();
+    QTest::newRow("delimiter too long") << QStringLiteral("auto s = R\"abcdefghijklmnopq(a\";") << false << QString();
+    QTest::newRow("space in the delimiter") << QStringLiteral("auto s = R\"a b(a\";") << false << QString();
+}
+
+void TestQSourceLexer::rawString() {
+    QFETCH(QString, line);
+    QFETCH(bool, opens);
+    QFETCH(QString, end);
+
+    QVector<QSourceLexer::Token> tokens;
+    const int state = QSourceLexer::lex(line, QSourceLexer::CodeCpp, tokens);
+    QCOMPARE(QSourceLexer::stateMode(state) == QSourceLexer::InRawString, opens);
+    QCOMPARE(QSourceLexer::lexState(line, QSourceLexer::CodeCpp), state);
+    if (!opens) return;
+
+    //a */ or a " doesn't close it
+    for (const QString &body : {QString(), QStringLiteral("*/ \" )z\"")}) {
+        QCOMPARE(QSourceLexer::lex(body, state, tokens), state);
+        QCOMPARE(QSourceLexer::lexState(body, state), state);
+    }
+
+    QCOMPARE(QSourceLexer::lex(end, state, tokens), int(QSourceLexer::CodeCpp));
+    QCOMPARE(QSourceLexer::lexState(end, state), int(QSourceLexer::CodeCpp));
+}
+
+void TestQSourceLexer::codeFence_data() {
+    QTest::addColumn<QString>("fence");
+    QTest::addColumn<int>("language");
+
+    QTest::newRow("python") << QStringLiteral("```python") << int(QSourceLexer::CodePython);
+    QTest::newRow("cpp") << QStringLiteral("```cpp") << int(QSourceLexer::CodeCpp);
+    QTest::newRow("attributes") << QStringLiteral("``` js {.numbered}") << int(QSourceLexer::CodeJs);
+    QTest::newRow("bash") << QStringLiteral("```bash") << int(QSourceLexer::CodeBash);
+    QTest::newRow("no language") << QStringLiteral("```") << int(QSourceLexer::CodeMarkdown);
+    QTest::newRow("unknown language") << QStringLiteral("```brainfuck") << int(QSourceLexer::CodeMarkdown);
+}
+
+void TestQSourceLexer::codeFence() {
+    QFETCH(QString, fence);
+    QFETCH(int, language);
+
+    //opens a multiline string or comment in most of the languages
+    const QString code = QStringLiteral("if x: y = 1 /* \"\"\" `");
+    QVector<QSourceLexer::Token> tokens;
+
+    //prose isn't lexed
+    int state = QSourceLexer::lex(code, QSourceLexer::CodeMarkdown, tokens);
+    QCOMPARE(state, int(QSourceLexer::CodeMarkdown));
+    QVERIFY(tokens.isEmpty());
+
+    //the fence picks the language, the document stays markdown
+    state = QSourceLexer::lex(fence, state, tokens);
+    QCOMPARE(QSourceLexer::lexState(fence, QSourceLexer::CodeMarkdown), state);
+    QCOMPARE(int(QSourceLexer::stateLanguage(state)), language);
+    QCOMPARE(int(QSourceLexer::stateDocumentLanguage(state)), int(QSourceLexer::CodeMarkdown));
+
+    //the code inside is lexed as that language, its state is carried on
+    const int inside = QSourceLexer::lex(code, state, tokens);
+    QCOMPARE(QSourceLexer::lexState(code, state), inside);
+    QCOMPARE(int(QSourceLexer::stateLanguage(inside)), language);
+    const bool keyword = !tokens.isEmpty() && tokens.first().offset == 0 &&
+                         tokens.first().kind == QSourceLexer::KeyWord;
+    QCOMPARE(keyword, language != QSourceLexer::CodeMarkdown);
+
+    //a fence closes it, whatever the code left open
+    const QString close = QStringLiteral("```");
+    state = QSourceLexer::lex(close, inside, tokens);
+    QCOMPARE(QSourceLexer::lexState(close, inside), state);
+    QCOMPARE(state, int(QSourceLexer::CodeMarkdown));
+    QCOMPARE(QSourceLexer::lex(code, state, tokens), int(QSourceLexer::CodeMarkdown));
+    QVERIFY(tokens.isEmpty());
+}
+
+void TestQSourceLexer::stringLiteral_data() {
+    QTest::addColumn<int>("language");
+    QTest::addColumn<QString>("line");
+    //the spans from the opening quote on, offset length kind
+    QTest::addColumn<QStringList>("spans");
+
+    const QString string = QString::number(QSourceLexer::String);
+    const QString escape = QString::number(QSourceLexer::NumLiteral);
+    QTest::newRow("plain") << int(QSourceLexer::CodeCpp) << QStringLiteral("s = \"hello world\";")
+                           << QStringList{QStringLiteral("4 13 ") + string};
+    QTest::newRow("escapes") << int(QSourceLexer::CodeCpp) << QStringLiteral("s = \"a\\nb\\x41c\";")
+                             << QStringList{QStringLiteral("4 2 ") + string, QStringLiteral("6 2 ") + escape,
+                                            QStringLiteral("8 1 ") + string, QStringLiteral("9 4 ") + escape,
+                                            QStringLiteral("13 2 ") + string};
+    QTest::newRow("escaped quote") << int(QSourceLexer::CodeCpp) << QStringLiteral("s = \"a\\\"b\";")
+                                   << QStringList{QStringLiteral("4 2 ") + string, QStringLiteral("6 2 ") + escape,
+                                                  QStringLiteral("8 2 ") + string};
+    QTest::newRow("not closed") << int(QSourceLexer::CodeCpp) << QStringLiteral("s = \"abc")
+                                << QStringList{QStringLiteral("4 4 ") + string};
+    //two strings that touch are one run of the same format
+    QTest::newRow("adjacent") << int(QSourceLexer::CodePython) << QStringLiteral("s = 'it''s'")
+                              << QStringList{QStringLiteral("4 7 ") + string};
+
+    //a data line with one long value is still a single span
+    const QString value = QString(5000, QLatin1Char('a'));
+    QTest::newRow("long json value") << int(QSourceLexer::CodeJSON)
+                                     << QStringLiteral("    \"%1\"").arg(value)
+                                     << QStringList{QStringLiteral("4 %1 ").arg(value.size() + 2) + string};
+}
+
+void TestQSourceLexer::stringLiteral() {
+    QFETCH(int, language);
+    QFETCH(QString, line);
+    QFETCH(QStringList, spans);
+
+    QVector<QSourceLexer::Token> tokens;
+    QSourceLexer::lex(line, language, tokens);
+    const int quote = spans.first().section(QLatin1Char(' '), 0, 0).toInt();
+    QStringList lexed;
+    for (const QSourceLexer::Token &token : qAsConst(tokens)) {
+        if (token.offset >= quote)
+            lexed.append(QStringLiteral("%1 %2 %3").arg(token.offset).arg(token.length).arg(int(token.kind)));
+    }
+    QCOMPARE(lexed, spans);
+}
+
+void TestQSourceLexer::detector_data() {
+    QTest::addColumn<QString>("text");
+    QTest::addColumn<int>("language");
+
+    //every sample is repeated up to the size the detector looks at
+    for (const Sample &sample : samples) {
+        const QString snippet = QString::fromUtf8(sample.text);
+        QString text;
+        while (text.size() < QSourceDetector::sampleSize)
+            text += snippet;
+        text.truncate(QSourceDetector::sampleSize);
+        QTest::newRow(sample.name) << text << int(sample.language);
+    }
+
+    //php opens at the start of the text, not wherever it is mentioned
+    QTest::newRow("php after a shebang")
+        << QStringLiteral("#!/usr/local/bin/php-cgi\n\n<?php\necho 'hello';\n") << int(QSourceLexer::CodePHP);
+    QTest::newRow("php in a comment")
+        << QStringLiteral("#include <string>\n\n// prints \"<?php\"\nint main() {\n    std::string s;\n"
+                          "    return 0;\n}\n")
+        << int(QSourceLexer::CodeCpp);
+    QTest::newRow("php in a string")
+        << QStringLiteral("import sys\n\n\ndef is_php(path):\n    with open(path) as f:\n"
+                          "        return f.read(5) == '<?php'\n\n\nif __name__ == '__main__':\n"
+                          "    for path in sys.argv[1:]:\n        if is_php(path):\n            print(path)\n"
+                          "        elif path.endswith('.py'):\n            pass\n")
+        << int(QSourceLexer::CodePython);
+}
+
+void TestQSourceLexer::detector() {
+    QFETCH(QString, text);
+    QFETCH(int, language);
+
+    QCOMPARE(int(QSourceDetector::detect(text)), language);
+}
+
+void TestQSourceLexer::detectSignature_data() {
+    QTest::addColumn<QString>("text");
+    QTest::addColumn<int>("language");
+
+    const int none = -1;
+    QTest::newRow("shebang") << QStringLiteral("#!/bin/sh\necho hi\n") << int(QSourceLexer::CodeBash);
+    QTest::newRow("php") << QStringLiteral("<?php\necho 'hi';\n") << int(QSourceLexer::CodePHP);
+    QTest::newRow("json") << QStringLiteral("{\n  \"a\": 1\n}\n") << int(QSourceLexer::CodeJSON);
+    QTest::newRow("license") << QStringLiteral("GNU GENERAL PUBLIC LICENSE\nVersion 3, 29 June 2007\n") << none;
+    QTest::newRow("makefile") << QStringLiteral("CXX = g++\n\nall: main\n\tg++ -o main main.o\n") << none;
+    QTest::newRow("code") << QStringLiteral("int main() {\n    return 0;\n}\n") << none;
+}
+
+void TestQSourceLexer::detectSignature() {
+    QFETCH(QString, text);
+    QFETCH(int, language);
+
+    const QSourceLexer::Language none = static_cast<QSourceLexer::Language>(0);
+    const int detected = QSourceDetector::detectSignature(text, none);
+    QCOMPARE(detected == none ? -1 : detected, language);
+}
+
+void TestQSourceLexer::lostDelimiter() {
+    //more distinct delimiters than the table holds, some may be in it already
+    QVector<QSourceLexer::Token> tokens;
+    for (int i = 0; i < 0x4000; ++i)
+        QSourceLexer::lex(QStringLiteral("cat <<DELIMITER%1").arg(i), QSourceLexer::CodeBash, tokens);
+
+    const QString line = QStringLiteral("cat <<LOST");
+    const int state = QSourceLexer::lex(line, QSourceLexer::CodeBash, tokens);
+    QCOMPARE(QSourceLexer::stateMode(state), QSourceLexer::InHereDoc);
+    QCOMPARE(QSourceLexer::lexState(line, QSourceLexer::CodeBash), state);
+
+    //the delimiter is gone, the body ends at the first empty line instead
+    const QString body = QStringLiteral("LOST");
+    QCOMPARE(QSourceLexer::lex(body, state, tokens), state);
+    QCOMPARE(QSourceLexer::lexState(body, state), state);
+    QCOMPARE(QSourceLexer::lex(QString(), state, tokens), int(QSourceLexer::CodeBash));
+    QCOMPARE(QSourceLexer::lexState(QString(), state), int(QSourceLexer::CodeBash));
+}
+
+QTEST_APPLESS_MAIN(TestQSourceLexer)
+
+#include "tst_qsourcelexer.moc"